@@ -0,0 +1,173 @@
+/* Benchmark for comparing results against errors
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+
+/* Measures nanoseconds per comparison when classifying a failed result by
+comparing it against a dozen errc values, as retry logic does, for codes of
+the generic, system and a non-errno category:
+
+  - `error_code==errc`, the standard library comparison of `r.error()`
+  - `result==failure`, comparing the result with `failure(errc)`
+  - `error_code==error_code` and `result==result`, against a dozen others
+
+Results are written to stdout as CSV, or as JSON if --json is passed.
+*/
+
+#include "../include/outcome/result.hpp"
+
+#include "harness.hpp"
+
+#include <ios>
+
+namespace outcome = OUTCOME_V2_NAMESPACE;
+
+extern volatile size_t forcereturn;
+volatile size_t forcereturn;
+
+static const std::errc retryable[] = {std::errc::resource_unavailable_try_again,
+                                      std::errc::operation_would_block,
+                                      std::errc::interrupted,
+                                      std::errc::timed_out,
+                                      std::errc::connection_reset,
+                                      std::errc::connection_aborted,
+                                      std::errc::connection_refused,
+                                      std::errc::network_down,
+                                      std::errc::network_unreachable,
+                                      std::errc::host_unreachable,
+                                      std::errc::no_buffer_space,
+                                      std::errc::device_or_resource_busy};
+static constexpr size_t retryable_count = sizeof(retryable) / sizeof(retryable[0]);
+
+struct errc_std
+{
+  static constexpr const char *name = "error_code==errc";
+  static BENCHMARK_NOINLINE size_t classify(const outcome::result<int> &r)
+  {
+    size_t ret = 0;
+    for(auto e : retryable)
+    {
+      ret += static_cast<size_t>(r.error() == e);
+    }
+    return ret;
+  }
+};
+struct errc_result
+{
+  static constexpr const char *name = "result==failure";
+  static BENCHMARK_NOINLINE size_t classify(const outcome::result<int> &r)
+  {
+    size_t ret = 0;
+    for(auto e : retryable)
+    {
+      ret += static_cast<size_t>(r == outcome::failure(e));
+    }
+    return ret;
+  }
+};
+static std::vector<outcome::result<int>> others;
+struct code_std
+{
+  static constexpr const char *name = "error_code==error_code";
+  static BENCHMARK_NOINLINE size_t classify(const outcome::result<int> &r)
+  {
+    size_t ret = 0;
+    for(const auto &o : others)
+    {
+      ret += static_cast<size_t>(r.error() == o.error());
+    }
+    return ret;
+  }
+};
+struct code_result
+{
+  static constexpr const char *name = "result==result";
+  static BENCHMARK_NOINLINE size_t classify(const outcome::result<int> &r)
+  {
+    size_t ret = 0;
+    for(const auto &o : others)
+    {
+      ret += static_cast<size_t>(r == o);
+    }
+    return ret;
+  }
+};
+
+static harness::options opts;
+
+template <class Method> static void measure(harness::report &out, const char *category, const outcome::result<int> &_r)
+{
+  // Read through a volatile each time, else the compiler sees classify() is pure and hoists it
+  const outcome::result<int> *volatile r = &_r;
+  std::vector<double> times;
+  for(size_t n = 0; n < opts.repeats; n++)
+  {
+    size_t total = 0;
+    const double start = harness::now_ns();
+    for(size_t i = 0; i < opts.batch; i++)
+    {
+      total += Method::classify(*r);
+    }
+    times.push_back((harness::now_ns() - start) / (double) (opts.batch * retryable_count));
+    forcereturn = total;
+  }
+  out.add("category", category).add("method", Method::name);
+  out.add("ns_per_comparison", harness::statistics(std::move(times)));
+  out.next_row();
+}
+
+int main(int argc, char *argv[])
+{
+  if(!opts.parse(argc, argv) || !opts.rest.empty())
+  {
+    harness::options::usage(argv[0]);
+    return 1;
+  }
+  if(!harness::pin_to_cpu(opts.cpu))
+  {
+    fprintf(stderr, "WARNING: Could not pin to a CPU, results will be noisier\n");
+  }
+  for(auto e : retryable)
+  {
+    others.emplace_back(std::error_code(static_cast<int>(e), std::system_category()));
+  }
+  const struct
+  {
+    const char *name;
+    std::error_code ec;
+  } codes[] = {{"generic", make_error_code(std::errc::timed_out)},  //
+               {"system", std::error_code(ETIMEDOUT, std::system_category())},
+               {"iostream", make_error_code(std::io_errc::stream)}};
+  harness::warm_up();
+  harness::report out;
+  for(const auto &c : codes)
+  {
+    const outcome::result<int> r(c.ec);
+    measure<errc_std>(out, c.name, r);
+    measure<errc_result>(out, c.name, r);
+    measure<code_std>(out, c.name, r);
+    measure<code_result>(out, c.name, r);
+  }
+  out.write(stdout, opts.json);
+  return 0;
+}
@@ -0,0 +1,129 @@
+/* Compile time benchmark for result and outcome
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* What is measured here is how long this file takes to compile, not how long
+it takes to run. It instantiates BENCHMARK_COMPILE_TIME_TYPES (default 500)
+distinct result<T> and outcome<T> types in one translation unit, and uses each
+the way typical code does: value, error and error condition construction,
+success() and failure(), in place construction, copies, OUTCOME_TRY and the
+observers. The cost is mostly instantiating each class, and resolving the
+overloads of its many constructors, which evaluates the constructor predicates
+for every argument type.
+
+The CMake target builds this with -ftime-trace on clang, which writes a
+Chrome trace JSON beside the object file (load it into chrome://tracing or
+https://ui.perfetto.dev), and with -ftime-report on GCC, which prints a
+per-phase breakdown including the memory allocated, which unlike the times is
+repeatable from run to run. The CMake cache variable
+OUTCOME_COMPILE_TIME_BENCHMARK_TYPES sets the number of types. Or simply time
+the compiler by hand:
+
+    time c++ -std=c++17 -c -I../include compile_time.cpp
+    time c++ -std=c++17 -c -I../include -DBENCHMARK_COMPILE_TIME_TYPES=1 compile_time.cpp
+
+The difference between the two is the cost of the instantiations.
+*/
+
+#include "../include/outcome/outcome.hpp"
+#include "../include/outcome/try.hpp"
+
+#include <cstdio>
+#include <utility>
+
+#ifndef BENCHMARK_COMPILE_TIME_TYPES
+#define BENCHMARK_COMPILE_TIME_TYPES 500
+#endif
+
+namespace compile_time
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+
+  template <size_t N> struct udt
+  {
+    int value;
+    explicit udt(int v)
+        : value(v)
+    {
+    }
+  };
+
+  template <size_t N> outcome::result<udt<N>> make_result(int v)
+  {
+    if(v < 0)
+    {
+      return std::errc::invalid_argument;
+    }
+    if(v == 0)
+    {
+      return outcome::failure(std::make_error_code(std::errc::no_such_file_or_directory));
+    }
+    if(v == 1)
+    {
+      return outcome::success(udt<N>(v));
+    }
+    return outcome::result<udt<N>>(outcome::in_place_type<udt<N>>, v);
+  }
+
+  template <size_t N> outcome::outcome<udt<N>> make_outcome(int v)
+  {
+    if(v < 0)
+    {
+      return std::make_exception_ptr(v);
+    }
+    if(v == 0)
+    {
+      return std::make_error_code(std::errc::no_such_file_or_directory);
+    }
+    OUTCOME_TRY(r, make_result<N>(v));
+    outcome::outcome<udt<N>> ret(r);
+    return ret;
+  }
+
+  template <size_t N> int use(int v)
+  {
+    outcome::result<udt<N>> r = make_result<N>(v);
+    outcome::result<udt<N>> copy(r);
+    outcome::outcome<udt<N>> o = make_outcome<N>(v);
+    if(!copy || !o)
+    {
+      return o.has_exception() ? -2 : -1;
+    }
+    return copy.value().value + o.value().value;
+  }
+
+  template <size_t... Ns> int use_all(int v, std::index_sequence<Ns...> /*unused*/)
+  {
+    int ret = 0;
+    (void) std::initializer_list<int>{(ret += use<Ns>(v), 0)...};
+    return ret;
+  }
+}  // namespace compile_time
+
+int main(int argc, char *argv[])
+{
+  (void) argv;
+  int total = compile_time::use_all(argc + 1, std::make_index_sequence<BENCHMARK_COMPILE_TIME_TYPES>());
+  printf("%d result and outcome types instantiated, total %d\n", BENCHMARK_COMPILE_TIME_TYPES, total);
+  return 0;
+}
@@ -0,0 +1,242 @@
+/* Benchmark for the eager/lazy/atomic awaitables
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Measures, for each of eager<T>, lazy<T>, atomic_eager<T> and atomic_lazy<T>:
+
+  - nanoseconds per co_await along a chain of nested coroutines
+  - bytes allocated for one coroutine frame
+  - heap allocations per chain
+  - how the above scale with chain depth and with concurrent threads
+
+Results are written to stdout as CSV, or as JSON if --json is passed.
+*/
+
+#include "../include/outcome/coroutine_support.hpp"
+#include "../include/outcome/result.hpp"
+#include "../include/outcome/try.hpp"
+
+#include "harness.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <thread>
+#include <vector>
+
+#if !defined(OUTCOME_FOUND_COROUTINE_HEADER)
+int main(void)
+{
+  fprintf(stderr, "This compiler does not support C++ Coroutines, nothing to benchmark.\n");
+  return 0;
+}
+#else
+
+/* Count every allocation made by this thread. Coroutine frames are allocated
+through the global operator new unless the promise type overrides it, which
+Outcome's promise types do not.
+*/
+static thread_local size_t allocation_count, allocation_bytes;
+
+/* GCC inlines these replacements into their callers, then warns that memory
+from operator new is freed with free(). That is correct here, as both sides are
+replaced together, and calling malloc() and free() directly keeps the counting
+from adding to the frame allocation being measured.
+*/
+#if !defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 11
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void *operator new(size_t bytes)
+{
+  ++allocation_count;
+  allocation_bytes += bytes;
+  if(void *ret = std::malloc(bytes ? bytes : 1))
+  {
+    return ret;
+  }
+  throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept
+{
+  std::free(p);
+}
+void operator delete(void *p, size_t /*unused*/) noexcept
+{
+  std::free(p);
+}
+#if !defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 11
+#pragma GCC diagnostic pop
+#endif
+
+namespace awaitables = OUTCOME_V2_NAMESPACE::awaitables;
+template <class T> using result = OUTCOME_V2_NAMESPACE::result<T>;
+
+extern volatile int forcereturn;
+volatile int forcereturn;
+
+template <template <class> class Awaitable> struct chain
+{
+  using awaitable_type = Awaitable<result<int>>;
+
+  static awaitable_type leaf(int x)
+  {
+    if(x < 0)
+    {
+      co_return std::errc::invalid_argument;
+    }
+    co_return x + 1;
+  }
+  static awaitable_type node(size_t depth, int x)
+  {
+    if(depth <= 1)
+    {
+      OUTCOME_CO_TRY(v, co_await leaf(x));
+      co_return v + 1;
+    }
+    OUTCOME_CO_TRY(v, co_await node(depth - 1, x));
+    co_return v + 1;
+  }
+  // Drive an awaitable to completion from outside of a coroutine
+  static result<int> run(awaitable_type &&a)
+  {
+    if(!a.await_ready())
+    {
+      a.await_suspend({});
+    }
+    return a.await_resume();
+  }
+};
+
+struct measurement
+{
+  const char *awaitable;
+  size_t depth, threads;
+  double ns_per_co_await;
+  size_t frame_bytes;
+  double allocations_per_chain;
+};
+
+static constexpr size_t iterations = 1U << 16U;
+static harness::options opts;
+
+// Returns nanoseconds per co_await for this thread, median of repeats
+template <template <class> class Awaitable> static double time_chain(size_t depth, size_t iters)
+{
+  std::vector<double> times;
+  for(size_t r = 0; r < opts.repeats; r++)
+  {
+    const double start = harness::now_ns();
+    for(size_t n = 0; n < iters; n++)
+    {
+      forcereturn = chain<Awaitable>::run(chain<Awaitable>::node(depth, (int) n)).value();
+    }
+    times.push_back((harness::now_ns() - start) / (double) (iters * depth));
+  }
+  return harness::statistics(std::move(times)).median;
+}
+
+template <template <class> class Awaitable> static measurement measure(const char *name, size_t depth, size_t threads)
+{
+  measurement ret{name, depth, threads, 0, 0, 0};
+  {
+    size_t bytes = allocation_bytes;
+    forcereturn = chain<Awaitable>::run(chain<Awaitable>::leaf(1)).value();
+    ret.frame_bytes = allocation_bytes - bytes;
+  }
+  {
+    size_t count = allocation_count;
+    forcereturn = chain<Awaitable>::run(chain<Awaitable>::node(depth, 1)).value();
+    ret.allocations_per_chain = (double) (allocation_count - count);
+  }
+  // Keep total work per thread roughly constant across depths
+  const size_t iters = std::max<size_t>(iterations / depth, 256);
+  if(threads == 1)
+  {
+    ret.ns_per_co_await = time_chain<Awaitable>(depth, iters);
+    return ret;
+  }
+  std::vector<double> results(threads);
+  std::vector<std::thread> workers;
+  std::atomic<size_t> ready(0);
+  for(size_t t = 0; t < threads; t++)
+  {
+    workers.emplace_back([&, t] {
+      // Each worker gets its own CPU, otherwise they would inherit the main thread's pinning
+      if(opts.cpu != -1)
+      {
+        harness::pin_to_cpu((int) t);
+      }
+      ++ready;
+      while(ready.load(std::memory_order_acquire) < threads)
+      {
+        std::this_thread::yield();
+      }
+      results[t] = time_chain<Awaitable>(depth, iters);
+    });
+  }
+  for(auto &i : workers)
+  {
+    i.join();
+  }
+  std::sort(results.begin(), results.end());
+  ret.ns_per_co_await = results[results.size() / 2];
+  return ret;
+}
+
+int main(int argc, char *argv[])
+{
+  if(!opts.parse(argc, argv) || !opts.rest.empty())
+  {
+    harness::options::usage(argv[0]);
+    return 1;
+  }
+  if(!harness::pin_to_cpu(opts.cpu))
+  {
+    fprintf(stderr, "WARNING: Could not pin to a CPU, results will be noisier\n");
+  }
+  harness::warm_up();
+  const size_t max_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  std::vector<measurement> results;
+  // Powers of two, then all the hardware threads if that is not one
+  for(size_t threads = 1; threads <= max_threads; threads = (threads < max_threads && threads * 2 > max_threads) ? max_threads : threads * 2)
+  {
+    for(size_t depth = 1; depth <= 64; depth *= 2)
+    {
+      results.push_back(measure<awaitables::eager>("eager", depth, threads));
+      results.push_back(measure<awaitables::lazy>("lazy", depth, threads));
+      results.push_back(measure<awaitables::atomic_eager>("atomic_eager", depth, threads));
+      results.push_back(measure<awaitables::atomic_lazy>("atomic_lazy", depth, threads));
+    }
+  }
+  harness::report out;
+  for(const auto &i : results)
+  {
+    out.add("awaitable", i.awaitable).add("depth", i.depth).add("threads", i.threads);
+    out.add("ns_per_co_await", i.ns_per_co_await).add("frame_bytes", i.frame_bytes).add("allocations_per_chain", i.allocations_per_chain);
+    out.next_row();
+  }
+  out.write(stdout, opts.json);
+  return 0;
+}
+#endif
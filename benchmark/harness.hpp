@@ -0,0 +1,313 @@
+/* Common benchmark harness
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef BENCHMARK_HARNESS_HPP
+#define BENCHMARK_HARNESS_HPP
+
+#include "perf_counters.hpp"
+#include "timing.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#ifdef _MSC_VER
+#define BENCHMARK_NOINLINE __declspec(noinline)
+#else
+#define BENCHMARK_NOINLINE __attribute__((noinline))
+#endif
+
+namespace harness
+{
+  //! Options common to all benchmarks
+  struct options
+  {
+    bool json{false};
+    //! The CPU to pin the measuring thread to, -1 for no pinning.
+    int cpu{-2};
+    //! How many times to repeat each measurement
+    size_t repeats{11};
+    //! How many operations to time per sample
+    size_t batch{1000};
+    //! Benchmark specific arguments not consumed by `parse()`
+    std::vector<const char *> rest;
+
+    /* Parses the common options `--json`, `--csv`, `--cpu N`, `--repeats N`
+    and `--batch N`. Anything else is left in `rest`.
+    */
+    bool parse(int argc, char *argv[])
+    {
+      for(int n = 1; n < argc; n++)
+      {
+        auto next = [&]() -> const char * { return (n + 1 < argc) ? argv[++n] : nullptr; };
+        if(0 == strcmp(argv[n], "--json"))
+        {
+          json = true;
+        }
+        else if(0 == strcmp(argv[n], "--csv"))
+        {
+          json = false;
+        }
+        else if(0 == strcmp(argv[n], "--cpu"))
+        {
+          const char *v = next();
+          if(v == nullptr)
+          {
+            return false;
+          }
+          cpu = atoi(v);
+        }
+        else if(0 == strcmp(argv[n], "--repeats") || 0 == strcmp(argv[n], "--batch"))
+        {
+          size_t &dest = (argv[n][2] == 'r') ? repeats : batch;
+          const char *v = next();
+          if(v == nullptr || atoi(v) <= 0)
+          {
+            return false;
+          }
+          dest = (size_t) atoi(v);
+        }
+        else
+        {
+          rest.push_back(argv[n]);
+        }
+      }
+      return true;
+    }
+    static void usage(const char *argv0, const char *extra = "")
+    {
+      fprintf(stderr, "Usage: %s [--json|--csv] [--cpu N] [--repeats N] [--batch N]%s\n", argv0, extra);
+    }
+  };
+
+  //! Parses a comma separated list of numbers into `out`, replacing its contents
+  template <class T> inline bool parse_list(std::vector<T> &out, const char *v)
+  {
+    out.clear();
+    for(const char *p = v; *p != 0;)
+    {
+      char *end;
+      const double i = strtod(p, &end);
+      if(end == p)
+      {
+        return false;
+      }
+      out.push_back((T) i);
+      p = (*end == ',') ? end + 1 : end;
+    }
+    return !out.empty();
+  }
+
+  //! Pins the calling thread to `cpu`. If `cpu` is -2, pins to whichever CPU we are currently on.
+  inline bool pin_to_cpu(int cpu)
+  {
+    if(cpu == -1)
+    {
+      return true;
+    }
+#if defined(__linux__)
+    if(cpu == -2)
+    {
+      cpu = sched_getcpu();
+      if(cpu < 0)
+      {
+        return false;
+      }
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return 0 == pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#elif defined(_WIN32)
+    if(cpu == -2)
+    {
+      cpu = (int) GetCurrentProcessorNumber();
+    }
+    return 0 != SetThreadAffinityMask(GetCurrentThread(), 1ULL << cpu);
+#else
+    (void) cpu;
+    return false;
+#endif
+  }
+
+  //! Spins the CPU for a while so frequency scaling has settled before measuring
+  inline void warm_up(double secs = 1)
+  {
+    usCount start = GetUsCount();
+    while((double) (GetUsCount() - start) < secs * 1000000000000.0)
+      ;
+  }
+
+  //! Nanoseconds since some arbitrary epoch
+  inline double now_ns() { return (double) GetUsCount() / 1000.0; }
+
+  //! Summary statistics of a set of samples
+  struct statistics
+  {
+    size_t samples{0};
+    double min{0}, median{0}, p99{0}, mean{0}, stddev{0};
+
+    explicit statistics(std::vector<double> v)
+    {
+      if(v.empty())
+      {
+        return;
+      }
+      std::sort(v.begin(), v.end());
+      samples = v.size();
+      min = v.front();
+      median = (v.size() & 1) ? v[v.size() / 2] : (v[v.size() / 2 - 1] + v[v.size() / 2]) / 2;
+      p99 = v[std::min(v.size() - 1, (size_t) std::ceil(0.99 * (double) v.size()) - 1)];
+      double sum = 0;
+      for(auto i : v)
+      {
+        sum += i;
+      }
+      mean = sum / (double) v.size();
+      double sq = 0;
+      for(auto i : v)
+      {
+        sq += (i - mean) * (i - mean);
+      }
+      stddev = (v.size() > 1) ? std::sqrt(sq / (double) (v.size() - 1)) : 0;
+    }
+  };
+
+  /*! Collects rows of named columns, then writes them out as CSV or JSON.
+  Every row must have the same columns in the same order.
+  */
+  class report
+  {
+    struct cell
+    {
+      std::string name, value;
+      bool quoted;
+    };
+    std::vector<std::vector<cell>> _rows;
+    std::vector<cell> _current;
+
+    static std::string _format(double v)
+    {
+      char buffer[64];
+      snprintf(buffer, sizeof(buffer), "%.3f", v);
+      return buffer;
+    }
+
+  public:
+    report &add(const char *name, const char *value)
+    {
+      _current.push_back(cell{name, value, true});
+      return *this;
+    }
+    report &add(const char *name, const std::string &value) { return add(name, value.c_str()); }
+    report &add(const char *name, double value)
+    {
+      _current.push_back(cell{name, std::isfinite(value) ? _format(value) : "null", false});
+      return *this;
+    }
+    report &add(const char *name, size_t value)
+    {
+      _current.push_back(cell{name, std::to_string(value), false});
+      return *this;
+    }
+    //! Adds `<prefix>_median`, `<prefix>_p99` etc columns
+    report &add(const char *prefix, const statistics &s)
+    {
+      std::string p(prefix);
+      add((p + "_median").c_str(), s.median);
+      add((p + "_p99").c_str(), s.p99);
+      add((p + "_mean").c_str(), s.mean);
+      add((p + "_stddev").c_str(), s.stddev);
+      add((p + "_min").c_str(), s.min);
+      return add("samples", s.samples);
+    }
+    //! Adds a `<counter>_<suffix>` column for each hardware counter, divided by `per`
+    report &add(const char *suffix, const perf_counters::values &v, double per)
+    {
+      for(int n = 0; n < perf_counters::counters_count; n++)
+      {
+        const auto c = (perf_counters::counter) n;
+        add((std::string(perf_counters::name(c)) + "_" + suffix).c_str(), v[c] / per);
+      }
+      return *this;
+    }
+    //! Finishes the current row
+    void next_row()
+    {
+      _rows.push_back(std::move(_current));
+      _current.clear();
+    }
+
+    void write(FILE *out, bool json) const
+    {
+      if(json)
+      {
+        fprintf(out, "[\n");
+        for(size_t n = 0; n < _rows.size(); n++)
+        {
+          fprintf(out, "  {");
+          for(size_t i = 0; i < _rows[n].size(); i++)
+          {
+            const auto &c = _rows[n][i];
+            fprintf(out, c.quoted ? "%s\"%s\": \"%s\"" : "%s\"%s\": %s", i ? ", " : "", c.name.c_str(), c.value.c_str());
+          }
+          fprintf(out, "}%s\n", (n + 1 < _rows.size()) ? "," : "");
+        }
+        fprintf(out, "]\n");
+        return;
+      }
+      if(_rows.empty())
+      {
+        return;
+      }
+      for(size_t i = 0; i < _rows.front().size(); i++)
+      {
+        fprintf(out, "%s%s", i ? "," : "", _rows.front()[i].name.c_str());
+      }
+      fprintf(out, "\n");
+      for(const auto &row : _rows)
+      {
+        for(size_t i = 0; i < row.size(); i++)
+        {
+          // CSV has no null, leave the cell empty instead
+          const auto &c = row[i];
+          fprintf(out, c.quoted ? "%s\"%s\"" : "%s%s", i ? "," : "", (c.value == "null") ? "" : c.value.c_str());
+        }
+        fprintf(out, "\n");
+      }
+    }
+  };
+}  // namespace harness
+
+#endif
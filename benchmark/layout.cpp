@@ -0,0 +1,134 @@
+/* Layout report for result and outcome
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Instantiates result, outcome, status_result and status_outcome over a matrix
+of value, error and exception types, and writes out the size, alignment,
+padding bytes and trivial copyability of each as CSV, or as JSON if --json is
+passed. Padding is whatever is left over after the value, error, exception and
+status bitfield, so it includes both the status bitfield's alignment padding
+and the tail padding of the side-by-side storage.
+
+The size budgets in layout_budgets.hpp are checked at compile time, as are any
+in the file named by the OUTCOME_LAYOUT_BUDGETS_FILE macro (the CMake cache
+variable OUTCOME_LAYOUT_BUDGETS sets this).
+*/
+
+#include "../include/outcome/outcome.hpp"
+#if __has_include("../include/outcome/experimental/status-code/include/system_error2.hpp")
+#include "../include/outcome/experimental/status_outcome.hpp"
+#define BENCHMARK_HAVE_STATUS_RESULT 1
+#endif
+
+#include "harness.hpp"
+#include "layout_budgets.hpp"
+#ifdef OUTCOME_LAYOUT_BUDGETS_FILE
+#include OUTCOME_LAYOUT_BUDGETS_FILE
+#endif
+
+#include <array>
+#include <string>
+#include <vector>
+
+namespace layout
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+
+  template <class T> struct type_name;
+#define LAYOUT_TYPE_NAME(...)                                                                                                                                  \
+  template <> struct type_name<__VA_ARGS__>                                                                                                                    \
+  {                                                                                                                                                            \
+    static constexpr const char *value = #__VA_ARGS__;                                                                                                         \
+  }
+  LAYOUT_TYPE_NAME(void);
+  LAYOUT_TYPE_NAME(char);
+  LAYOUT_TYPE_NAME(int);
+  LAYOUT_TYPE_NAME(long long);
+  LAYOUT_TYPE_NAME(double);
+  LAYOUT_TYPE_NAME(void *);
+  LAYOUT_TYPE_NAME(std::string);
+  LAYOUT_TYPE_NAME(std::vector<int>);
+  LAYOUT_TYPE_NAME(std::array<char, 64>);
+  LAYOUT_TYPE_NAME(std::error_code);
+  LAYOUT_TYPE_NAME(std::exception_ptr);
+#ifdef BENCHMARK_HAVE_STATUS_RESULT
+  LAYOUT_TYPE_NAME(outcome::experimental::system_code);
+  LAYOUT_TYPE_NAME(outcome::experimental::generic_code);
+#endif
+#undef LAYOUT_TYPE_NAME
+
+  template <class T> struct size_of : std::integral_constant<size_t, sizeof(T)>
+  {
+  };
+  template <> struct size_of<void> : std::integral_constant<size_t, 0>
+  {
+  };
+
+  // basic_result has no exception_type
+  template <class T, class = typename T::exception_type> constexpr size_t exception_size(int /*unused*/) { return size_of<typename T::exception_type>::value; }
+  template <class T> constexpr size_t exception_size(...) { return 0; }
+  template <class T, class = typename T::exception_type> constexpr const char *exception_name(int /*unused*/) { return type_name<typename T::exception_type>::value; }
+  template <class T> constexpr const char *exception_name(...) { return ""; }
+
+  template <class T> inline void row(harness::report &out, const char *kind)
+  {
+    constexpr size_t payload = size_of<typename T::value_type>::value + size_of<typename T::error_type>::value + exception_size<T>(0) +
+                               sizeof(outcome::detail::status_bitfield_type);
+    out.add("type", kind).add("value_type", type_name<typename T::value_type>::value).add("error_type", type_name<typename T::error_type>::value);
+    out.add("exception_type", exception_name<T>(0));
+    out.add("size", sizeof(T)).add("alignment", alignof(T)).add("payload", payload).add("padding", sizeof(T) - payload);
+    out.add("trivially_copyable", std::is_trivially_copyable<T>::value ? "true" : "false");
+    out.next_row();
+  }
+
+  template <class... Ts> struct values
+  {
+    template <class F> static void each(F &&f) { (void) std::initializer_list<int>{(f(static_cast<Ts *>(nullptr)), 0)...}; }
+  };
+  using value_types = values<void, char, int, long long, double, void *, std::string, std::vector<int>, std::array<char, 64>>;
+}  // namespace layout
+
+int main(int argc, char *argv[])
+{
+  using namespace layout;
+  harness::options opts;
+  if(!opts.parse(argc, argv) || !opts.rest.empty())
+  {
+    harness::options::usage(argv[0]);
+    return 1;
+  }
+  harness::report out;
+  value_types::each([&](auto *v) {
+    using T = std::remove_pointer_t<decltype(v)>;
+    row<outcome::result<T, std::error_code>>(out, "result");
+    row<outcome::result<T, std::exception_ptr>>(out, "result");
+    row<outcome::outcome<T>>(out, "outcome");
+#ifdef BENCHMARK_HAVE_STATUS_RESULT
+    row<outcome::experimental::status_result<T>>(out, "status_result");
+    row<outcome::experimental::status_result<T, outcome::experimental::generic_code>>(out, "status_result");
+    row<outcome::experimental::status_outcome<T>>(out, "status_outcome");
+#endif
+  });
+  out.write(stdout, opts.json);
+  return 0;
+}
@@ -0,0 +1,53 @@
+/* Size budgets for result and outcome
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef BENCHMARK_LAYOUT_BUDGETS_HPP
+#define BENCHMARK_LAYOUT_BUDGETS_HPP
+
+/*! Fails the build if `sizeof(type)` exceeds `bytes`. Use this in your own
+budgets file, named to the layout report by OUTCOME_LAYOUT_BUDGETS_FILE.
+*/
+#define OUTCOME_LAYOUT_BUDGET(bytes, ...) static_assert(sizeof(__VA_ARGS__) <= (bytes), #__VA_ARGS__ " exceeds its layout budget of " #bytes " bytes")
+
+/* These only name types whose layout does not depend on the standard library
+implementation, and are only for 64 bit targets.
+*/
+#if defined(__x86_64__) || defined(_M_X64) || defined(__aarch64__) || defined(_M_ARM64)
+OUTCOME_LAYOUT_BUDGET(24, OUTCOME_V2_NAMESPACE::result<void>);
+OUTCOME_LAYOUT_BUDGET(24, OUTCOME_V2_NAMESPACE::result<int>);
+OUTCOME_LAYOUT_BUDGET(32, OUTCOME_V2_NAMESPACE::result<double>);
+OUTCOME_LAYOUT_BUDGET(32, OUTCOME_V2_NAMESPACE::result<void *>);
+OUTCOME_LAYOUT_BUDGET(16, OUTCOME_V2_NAMESPACE::result<int, std::exception_ptr>);
+OUTCOME_LAYOUT_BUDGET(32, OUTCOME_V2_NAMESPACE::outcome<void>);
+OUTCOME_LAYOUT_BUDGET(32, OUTCOME_V2_NAMESPACE::outcome<int>);
+OUTCOME_LAYOUT_BUDGET(40, OUTCOME_V2_NAMESPACE::outcome<double>);
+#ifdef BENCHMARK_HAVE_STATUS_RESULT
+OUTCOME_LAYOUT_BUDGET(24, OUTCOME_V2_NAMESPACE::experimental::status_result<void>);
+OUTCOME_LAYOUT_BUDGET(24, OUTCOME_V2_NAMESPACE::experimental::status_result<int>);
+OUTCOME_LAYOUT_BUDGET(32, OUTCOME_V2_NAMESPACE::experimental::status_result<double>);
+OUTCOME_LAYOUT_BUDGET(32, OUTCOME_V2_NAMESPACE::experimental::status_outcome<int>);
+#endif
+#endif
+
+#endif
@@ -0,0 +1,216 @@
+#!/usr/bin/python3
+# Outcome modules build time benchmark
+# (C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+# File Created: Oct 2026
+#
+# Times a full rebuild of the unit test suite twice: once as written, each test
+# #including the Outcome headers, and once with those #includes replaced by
+# `import outcome;` (or `import outcome.experimental;`), the time for the
+# second including building the module interfaces themselves.
+#
+# Usage: modules_rebuild.py [--compiler PATH] [--family gcc|clang]
+#                           [--output-dir DIR] [--jobs N] [--repeats N]
+#                           [--json] [--generate-only] [tests...] [-- flags...]
+#
+# Anything after -- is passed to every compile, at least the include path for
+# quickcpplib is needed. The rewritten test sources are written to the
+# output directory, which the CMake build also uses to make its -modules tests
+# (see OUTCOME_ENABLE_CXX_MODULES). Only the tests which compile both ways are
+# counted in the totals, the others are listed with an empty import time.
+#
+# Modules do not export macros, so the rewritten tests #include
+# "outcome/try_macros.hpp" for OUTCOME_V2_NAMESPACE and the TRY macros. They
+# also #include what the modules' global module fragments do before importing,
+# as GCC before 14 needs, and status-code too for the experimental module.
+
+import argparse
+import concurrent.futures
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import time
+
+
+_here_ = os.path.dirname(os.path.abspath(__file__))
+_root_ = os.path.dirname(_here_)
+_include_ = os.path.join(_root_, "include")
+_tests_ = os.path.join(_root_, "test", "tests")
+
+_default_compiler_ = \
+    { "gcc"   : "g++"
+    , "clang" : "clang++"
+    }
+
+# (module name, interface source)
+_modules_ = \
+    [ ("outcome", os.path.join(_include_, "outcome.ixx"))
+    , ("outcome.experimental", os.path.join(_include_, "outcome", "experimental.ixx"))
+    ]
+
+_outcome_include_ = re.compile(r'^\s*#\s*include\s+"(?:\.\./)*include/(outcome[^"]*)"')
+
+
+def detect_family(compiler : str) -> str:
+    return "clang" if "clang" in os.path.basename(compiler).lower() else "gcc"
+
+
+#
+# Returns the test source with each of its Outcome #includes replaced by an
+# import, or None if it includes no Outcome headers. Importing twice is
+# harmless, so this works for #includes inside #if blocks too.
+#
+def rewrite_test(source : str) -> str:
+    lines = source.split("\n")
+    found = [n for n, line in enumerate(lines) if _outcome_include_.match(line)]
+    if not found:
+        return None
+    experimental = any("experimental/" in _outcome_include_.match(lines[n]).group(1) for n in found)
+    replacement = ['#include "outcome/detail/global_module_fragment.hpp"']
+    if experimental:
+        replacement.append('#include "outcome/experimental/status-code/include/system_error2.hpp"')
+    replacement.append('#include "outcome/try_macros.hpp"')
+    replacement.append("import outcome.experimental;" if experimental else "import outcome;")
+    for n in reversed(found):
+        lines[n:n + 1] = replacement
+    return "\n".join(lines)
+
+
+def generate_sources(tests : list, outdir : str) -> list:
+    generated = []
+    for test in tests:
+        name = os.path.splitext(os.path.basename(test))[0]
+        with open(test, "rt") as ih:
+            rewritten = rewrite_test(ih.read())
+        if rewritten is None:
+            continue
+        path = os.path.join(outdir, name + ".cpp")
+        # Only write if changed, so build systems do not rebuild needlessly
+        if not os.path.exists(path) or open(path, "rt").read() != rewritten:
+            with open(path, "wt") as oh:
+                oh.write(rewritten)
+        generated.append((name, test, path))
+    return generated
+
+
+class Compiler:
+    def __init__(self, compiler : str, family : str, outdir : str, flags : list):
+        self.compiler, self.family, self.outdir = compiler, family, outdir
+        self.flags = ["-std=c++20", "-I" + _include_] + flags
+        self.module_flags = ["-fmodules-ts"] if family == "gcc" else []
+
+    # Returns the seconds taken, or None if it failed to compile
+    def _run(self, args : list):
+        begin = time.perf_counter()
+        result = subprocess.run([self.compiler] + args, cwd=self.outdir, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+        elapsed = time.perf_counter() - begin
+        if result.returncode != 0:
+            with open(os.path.join(self.outdir, os.path.basename(args[args.index("-o") + 1]) + ".log"), "wb") as oh:
+                oh.write(result.stdout)
+            return None
+        return elapsed
+
+    def compile_module(self, name : str, interface : str):
+        if self.family == "gcc":
+            # GCC writes the compiled module interface into gcm.cache/ in the working directory
+            return self._run(self.flags + self.module_flags + ["-c", "-o", name + ".o", "-x", "c++", interface])
+        pcm = os.path.join(self.outdir, name + ".pcm")
+        t1 = self._run(self.flags + ["--precompile", "-o", pcm, "-x", "c++-module", interface])
+        t2 = self._run(["-c", "-o", name + ".o", pcm]) if t1 is not None else None
+        return None if t2 is None else t1 + t2
+
+    def compile_test(self, source : str, modules : bool):
+        obj = os.path.splitext(os.path.basename(source))[0] + (".import.o" if modules else ".include.o")
+        flags = self.flags
+        if modules:
+            flags = flags + self.module_flags
+            if self.family == "clang":
+                flags = flags + ["-fprebuilt-module-path=" + self.outdir]
+        return self._run(flags + ["-c", "-o", obj, source])
+
+
+#
+# Compiles every source, returning (wall clock seconds, seconds for each source)
+#
+def build_all(compile, sources : list, jobs : int):
+    begin = time.perf_counter()
+    with concurrent.futures.ThreadPoolExecutor(max_workers=jobs) as pool:
+        times = list(pool.map(compile, sources))
+    return time.perf_counter() - begin, times
+
+
+def main() -> int:
+    argv = sys.argv[1:]
+    flags = []
+    if "--" in argv:
+        flags = argv[argv.index("--") + 1:]
+        argv = argv[:argv.index("--")]
+    parser = argparse.ArgumentParser(description="Compare the time to rebuild the test suite with #include against with import")
+    parser.add_argument("--compiler", default=os.environ.get("CXX"), help="compiler to use, defaults to $CXX")
+    parser.add_argument("--family", choices=sorted(_default_compiler_.keys()), help="compiler family, defaults to guessing from the compiler name")
+    parser.add_argument("--output-dir", default=os.path.join(os.getcwd(), "modules_rebuild"), help="where to write the rewritten tests and the objects")
+    parser.add_argument("--jobs", type=int, default=1, help="how many compiles to run at once")
+    parser.add_argument("--repeats", type=int, default=1, help="how many times to rebuild, the fastest is reported")
+    parser.add_argument("--json", action="store_true", help="write JSON rather than CSV")
+    parser.add_argument("--generate-only", action="store_true", help="only write out the rewritten tests")
+    parser.add_argument("tests", nargs="*", help="tests to build, defaults to all")
+    args = parser.parse_args(argv)
+
+    if not os.path.isdir(args.output_dir):
+        os.makedirs(args.output_dir)
+    tests = [os.path.abspath(t) for t in args.tests] or sorted(os.path.join(_tests_, t) for t in os.listdir(_tests_) if t.endswith(".cpp"))
+    generated = generate_sources(tests, args.output_dir)
+    if args.generate_only:
+        return 0
+
+    family = args.family or (detect_family(args.compiler) if args.compiler else "gcc")
+    compiler = Compiler(args.compiler or _default_compiler_[family], family, args.output_dir, flags)
+    have_status_code = os.path.exists(os.path.join(_include_, "outcome", "experimental", "status-code", "include", "system_error2.hpp"))
+    modules = [m for m in _modules_ if have_status_code or m[0] != "outcome.experimental"]
+
+    best = None
+    for _ in range(args.repeats):
+        shutil.rmtree(os.path.join(args.output_dir, "gcm.cache"), ignore_errors=True)
+        include_wall, include_times = build_all(lambda g: compiler.compile_test(g[1], False), generated, args.jobs)
+        # The module interfaces must be built before anything importing them
+        modules_begin = time.perf_counter()
+        _, module_times = build_all(lambda m: compiler.compile_module(*m), modules, args.jobs)
+        modules_wall = time.perf_counter() - modules_begin
+        for (name, _), t in zip(modules, module_times):
+            if t is None:
+                print("[-] Failed to compile module " + name + ", see the .log beside it in " + args.output_dir, file=sys.stderr)
+                return 1
+        import_wall, import_times = build_all(lambda g: compiler.compile_test(g[2], True), generated, args.jobs)
+        if best is None or include_wall + import_wall < best[0][0] + best[0][1]:
+            best = ((include_wall, modules_wall + import_wall), include_times, import_times, module_times)
+
+    (include_wall, import_wall), include_times, import_times, module_times = best
+    rows = []
+    for (name, _), t in zip(modules, module_times):
+        rows.append({"source": "module " + name, "include_seconds": None, "import_seconds": t})
+    counted = [0.0, 0.0]
+    for (name, _, _), ti, tm in zip(generated, include_times, import_times):
+        rows.append({"source": name, "include_seconds": ti, "import_seconds": tm})
+        if ti is not None and tm is not None:
+            counted[0] += ti
+            counted[1] += tm
+        elif tm is None:
+            print("[-] " + name + " did not compile with import, see " + os.path.join(args.output_dir, name + ".import.o.log"), file=sys.stderr)
+    counted[1] += sum(module_times)
+    rows.append({"source": "total cpu", "include_seconds": counted[0], "import_seconds": counted[1]})
+    rows.append({"source": "total wall clock", "include_seconds": include_wall, "import_seconds": import_wall})
+
+    if args.json:
+        json.dump(rows, sys.stdout, indent=2)
+        sys.stdout.write("\n")
+    else:
+        print("source,include_seconds,import_seconds")
+        for row in rows:
+            print('"' + row["source"] + '",' + ",".join("" if row[k] is None else "%.3f" % row[k] for k in ("include_seconds", "import_seconds")))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
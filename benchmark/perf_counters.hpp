@@ -0,0 +1,189 @@
+/* Hardware performance counters for the benchmark harness
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef BENCHMARK_PERF_COUNTERS_HPP
+#define BENCHMARK_PERF_COUNTERS_HPP
+
+#include <cmath>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace harness
+{
+  /*! Counts hardware events on the calling thread between `start()` and
+  `stop()`. On Linux this uses `perf_event_open()`, elsewhere nothing is
+  available. Each counter is opened separately so that when the kernel or
+  the CPU refuses one (`perf_event_paranoid`, virtual machines without a
+  PMU, too few hardware counters), the others still work. Unavailable
+  counters read as NaN, which the report writes out as null.
+  */
+  class perf_counters
+  {
+  public:
+    enum counter
+    {
+      cycles,
+      instructions,
+      branch_misses,
+      l1i_misses,
+      itlb_misses,
+      counters_count
+    };
+    static const char *name(counter c)
+    {
+      static const char *const names[] = {"cycles", "instructions", "branch_misses", "l1i_misses", "itlb_misses"};
+      return names[c];
+    }
+
+    struct values
+    {
+      double v[counters_count];
+      double operator[](counter c) const { return v[c]; }
+      values &operator+=(const values &o)
+      {
+        for(int n = 0; n < counters_count; n++)
+        {
+          v[n] += o.v[n];
+        }
+        return *this;
+      }
+    };
+
+  private:
+    int _fd[counters_count];
+
+#if defined(__linux__)
+    static int _open(uint32_t type, uint64_t config)
+    {
+      perf_event_attr attr{};
+      attr.size = sizeof(attr);
+      attr.type = type;
+      attr.config = config;
+      attr.disabled = 1;
+      // Userspace only, which works at perf_event_paranoid <= 2 without privileges
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      return (int) syscall(SYS_perf_event_open, &attr, 0 /* this thread */, -1 /* any cpu */, -1 /* no group */, 0);
+    }
+    static constexpr uint64_t _cache(uint64_t cache, uint64_t op, uint64_t result) { return cache | (op << 8U) | (result << 16U); }
+#endif
+
+  public:
+    perf_counters()
+    {
+#if defined(__linux__)
+      _fd[cycles] = _open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+      _fd[instructions] = _open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+      _fd[branch_misses] = _open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+      _fd[l1i_misses] = _open(PERF_TYPE_HW_CACHE, _cache(PERF_COUNT_HW_CACHE_L1I, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS));
+      _fd[itlb_misses] = _open(PERF_TYPE_HW_CACHE, _cache(PERF_COUNT_HW_CACHE_ITLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS));
+#else
+      for(auto &fd : _fd)
+      {
+        fd = -1;
+      }
+#endif
+    }
+    perf_counters(const perf_counters &) = delete;
+    perf_counters &operator=(const perf_counters &) = delete;
+    ~perf_counters()
+    {
+#if defined(__linux__)
+      for(auto fd : _fd)
+      {
+        if(fd >= 0)
+        {
+          ::close(fd);
+        }
+      }
+#endif
+    }
+
+    bool available(counter c) const { return _fd[c] >= 0; }
+    bool any_available() const
+    {
+      for(auto fd : _fd)
+      {
+        if(fd >= 0)
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    void start()
+    {
+#if defined(__linux__)
+      for(auto fd : _fd)
+      {
+        if(fd >= 0)
+        {
+          ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+          ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+      }
+#endif
+    }
+    void stop()
+    {
+#if defined(__linux__)
+      for(auto fd : _fd)
+      {
+        if(fd >= 0)
+        {
+          ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+      }
+#endif
+    }
+
+    //! The counts since `start()`, scaled up if the kernel had to multiplex the counter
+    values read() const
+    {
+      values ret;
+      for(int n = 0; n < counters_count; n++)
+      {
+        ret.v[n] = NAN;
+#if defined(__linux__)
+        uint64_t buffer[3];  // value, time enabled, time running
+        if(_fd[n] >= 0 && ::read(_fd[n], buffer, sizeof(buffer)) == (ssize_t) sizeof(buffer) && buffer[2] > 0)
+        {
+          ret.v[n] = (double) buffer[0] * ((double) buffer[1] / (double) buffer[2]);
+        }
+#endif
+      }
+      return ret;
+    }
+  };
+}  // namespace harness
+
+#endif
@@ -0,0 +1,441 @@
+/* Benchmark of error propagation through call chains
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* This replaces the old benchmark.py, which generated one source file per
+stack frame and compiled a new executable per configuration. Here each stack
+frame is a non-inlined template instance, so one executable sweeps:
+
+  - the error handling system (integer returns, exceptions, result, outcome, status_result)
+  - the value type returned
+  - the nesting depth of the call chain
+  - the proportion of calls which fail, from 0% to 100%
+  - the number of threads running the chains concurrently (--threads 1,2,4,...)
+
+Each configuration is timed in batches of calls. The per-call median, p99,
+mean, stddev and minimum over all batches are written out as CSV, or as JSON
+if --json is passed, along with the total calls per second across all threads.
+Where the platform allows it, hardware counters for cycles, instructions,
+branch misses, L1 instruction cache misses and instruction TLB misses are
+also recorded around the measured loops and reported per call.
+
+Many C++ runtimes take global locks during exception unwinding, so only the
+multithreaded numbers show what throwing costs a busy thread pool. The
+`scaling` column is throughput relative to the single threaded throughput
+times the thread count, so 1.0 is perfect scaling.
+*/
+
+#include "../include/outcome/outcome.hpp"
+#include "../include/outcome/try.hpp"
+#if __has_include("../include/outcome/experimental/status-code/include/system_error2.hpp")
+#include "../include/outcome/experimental/status_result.hpp"
+#define BENCHMARK_HAVE_STATUS_RESULT 1
+#endif
+
+#include "harness.hpp"
+
+#include <atomic>
+#include <random>
+#include <string>
+#include <thread>
+
+// Thread local so the multithreaded mode does not measure cache line contention on it
+static thread_local volatile int counter;
+
+namespace propagation
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+
+  struct RAII
+  {
+    RAII() { counter = counter + 1; }
+    ~RAII() { counter = counter - 1; }
+  };
+
+  // The value types returned along the chain
+  template <class T> struct value_traits;
+  template <> struct value_traits<int>
+  {
+    static constexpr const char *name = "int";
+    static int make(int par) { return par; }
+  };
+  template <> struct value_traits<std::string>
+  {
+    static constexpr const char *name = "std::string";
+    static std::string make(int /*unused*/) { return "short string"; }
+  };
+
+  /* Each error handling system supplies:
+
+    - `value_type` and `return_type`
+    - `leaf(fail, par)` which succeeds or fails
+    - `propagate<Next>(fail, par)` which calls the next frame and passes on any failure
+    - `run<Next>(fail)` which calls the top of the chain and returns whether it succeeded
+  */
+  template <class T> struct integer_returns
+  {
+    static constexpr const char *name = "integer-returns";
+    using value_type = T;
+    using return_type = int;
+    static return_type leaf(int fail, int par) { return fail ? -1 : par; }
+    template <class Next> static return_type propagate(int fail, int par)
+    {
+      int r = Next::call(fail, par + 1);
+      if(r < 0)
+      {
+        return r;
+      }
+      return r + 1;
+    }
+    template <class Next> static bool run(int fail) { return Next::call(fail, 0) >= 0; }
+  };
+#ifdef __cpp_exceptions
+  template <class T> struct exception_throw
+  {
+    static constexpr const char *name = "exception-throw";
+    using value_type = T;
+    using return_type = T;
+    static return_type leaf(int fail, int par)
+    {
+      if(fail)
+      {
+        throw std::exception();
+      }
+      return value_traits<T>::make(par);
+    }
+    template <class Next> static return_type propagate(int fail, int par) { return Next::call(fail, par + 1); }
+    template <class Next> static bool run(int fail)
+    {
+      try
+      {
+        (void) Next::call(fail, 0);
+        return true;
+      }
+      catch(const std::exception & /*unused*/)
+      {
+        return false;
+      }
+    }
+  };
+#endif
+  template <class T, class R> struct result_like
+  {
+    using value_type = T;
+    using return_type = R;
+    template <class Next> static return_type propagate(int fail, int par)
+    {
+      OUTCOME_TRY(v, Next::call(fail, par + 1));
+      return static_cast<decltype(v) &&>(v);
+    }
+    template <class Next> static bool run(int fail) { return Next::call(fail, 0).has_value(); }
+  };
+  template <class T> struct result_error : result_like<T, outcome::result<T>>
+  {
+    static constexpr const char *name = "result-error";
+    static outcome::result<T> leaf(int fail, int par)
+    {
+      if(fail)
+      {
+        return std::error_code(5, std::generic_category());
+      }
+      return value_traits<T>::make(par);
+    }
+  };
+  template <class T> struct result_excpt : result_like<T, outcome::result<T, std::exception_ptr>>
+  {
+    static constexpr const char *name = "result-excpt";
+    static outcome::result<T, std::exception_ptr> leaf(int fail, int par)
+    {
+      if(fail)
+      {
+        return std::make_exception_ptr(std::exception());
+      }
+      return value_traits<T>::make(par);
+    }
+  };
+  template <class T> struct outcome_error : result_like<T, outcome::outcome<T>>
+  {
+    static constexpr const char *name = "outcome-error";
+    static outcome::outcome<T> leaf(int fail, int par)
+    {
+      if(fail)
+      {
+        return std::error_code(5, std::generic_category());
+      }
+      return value_traits<T>::make(par);
+    }
+  };
+#ifdef BENCHMARK_HAVE_STATUS_RESULT
+  template <class T> struct result_exper : result_like<T, outcome::experimental::status_result<T>>
+  {
+    static constexpr const char *name = "result-exper";
+    static outcome::experimental::status_result<T> leaf(int fail, int par)
+    {
+      if(fail)
+      {
+        return outcome::experimental::errc::io_error;
+      }
+      return value_traits<T>::make(par);
+    }
+  };
+#endif
+
+  // One stack frame of the call chain per Depth
+  template <class System, size_t Depth> struct chain
+  {
+    static BENCHMARK_NOINLINE typename System::return_type call(int fail, int par)
+    {
+      RAII raii;
+      return System::template propagate<chain<System, Depth - 1>>(fail, par);
+    }
+  };
+  template <class System> struct chain<System, 0>
+  {
+    static BENCHMARK_NOINLINE typename System::return_type call(int fail, int par) { return System::leaf(fail, par); }
+  };
+
+  using runner_type = bool (*)(int);
+  static constexpr size_t depths[] = {1, 2, 4, 8, 16, 32};
+  template <class System> struct runners
+  {
+    static constexpr runner_type value[] = {&System::template run<chain<System, 1>>,  &System::template run<chain<System, 2>>,
+                                            &System::template run<chain<System, 4>>,  &System::template run<chain<System, 8>>,
+                                            &System::template run<chain<System, 16>>, &System::template run<chain<System, 32>>};
+  };
+  template <class System> constexpr runner_type runners<System>::value[];
+
+  // A reproducible pattern of which calls fail, with exactly the requested proportion failing
+  inline std::vector<int> failure_pattern(size_t count, double rate)
+  {
+    std::vector<int> ret(count, 0);
+    const auto failures = (size_t)(rate * (double) count + 0.5);
+    std::fill(ret.begin(), ret.begin() + std::min(failures, count), 1);
+    std::mt19937 rand(78);
+    std::shuffle(ret.begin(), ret.end(), rand);
+    return ret;
+  }
+
+  struct config
+  {
+    harness::options opts;
+    std::vector<double> rates{0, 0.001, 0.005, 0.01, 0.02, 0.05, 0.1, 0.5, 1};
+    std::vector<size_t> threads{1};
+    size_t max_depth{32};
+  };
+
+  struct measurement
+  {
+    //! Nanoseconds per call for each batch on every thread
+    std::vector<double> samples;
+    double calls_per_sec{0};
+    //! Hardware counter totals summed over every thread
+    harness::perf_counters::values counters{};
+    size_t calls{0};
+  };
+
+  // Appends nanoseconds per call for each batch, and returns how many calls were made
+  inline size_t time_batches(std::vector<double> &samples, harness::perf_counters::values &counters, const config &cfg, runner_type runner, const std::vector<int> &pattern)
+  {
+    // Counters are per thread, so each thread opens its own
+    harness::perf_counters pc;
+    size_t failed = 0, calls = 0;
+    pc.start();
+    for(size_t r = 0; r < cfg.opts.repeats; r++)
+    {
+      for(size_t b = 0; b + cfg.opts.batch <= pattern.size(); b += cfg.opts.batch)
+      {
+        const int *p = pattern.data() + b;
+        const double begin = harness::now_ns();
+        for(size_t n = 0; n < cfg.opts.batch; n++)
+        {
+          failed += !runner(p[n]);
+        }
+        const double end = harness::now_ns();
+        samples.push_back((end - begin) / (double) cfg.opts.batch);
+        calls += cfg.opts.batch;
+      }
+    }
+    pc.stop();
+    counters = pc.read();
+    counter = counter + (int) failed;
+    return calls;
+  }
+
+  inline measurement time_runner(const config &cfg, runner_type runner, const std::vector<int> &pattern, size_t threads)
+  {
+    measurement ret;
+    if(threads == 1)
+    {
+      const double begin = harness::now_ns();
+      ret.calls = time_batches(ret.samples, ret.counters, cfg, runner, pattern);
+      ret.calls_per_sec = (double) ret.calls * 1000000000.0 / (harness::now_ns() - begin);
+      return ret;
+    }
+    const size_t cpus = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    std::vector<std::vector<double>> samples(threads);
+    std::vector<size_t> calls(threads);
+    std::vector<harness::perf_counters::values> counters(threads);
+    std::vector<std::thread> workers;
+    std::atomic<size_t> ready(0);
+    std::atomic<bool> go(false);
+    for(size_t t = 0; t < threads; t++)
+    {
+      workers.emplace_back([&, t] {
+        // Each worker gets its own CPU, otherwise they would inherit the main thread's pinning
+        if(cfg.opts.cpu != -1)
+        {
+          harness::pin_to_cpu((int) (t % cpus));
+        }
+        ++ready;
+        while(!go.load(std::memory_order_acquire))
+        {
+          std::this_thread::yield();
+        }
+        calls[t] = time_batches(samples[t], counters[t], cfg, runner, pattern);
+      });
+    }
+    while(ready.load(std::memory_order_acquire) < threads)
+    {
+      std::this_thread::yield();
+    }
+    const double begin = harness::now_ns();
+    go.store(true, std::memory_order_release);
+    for(auto &i : workers)
+    {
+      i.join();
+    }
+    const double end = harness::now_ns();
+    for(size_t t = 0; t < threads; t++)
+    {
+      ret.samples.insert(ret.samples.end(), samples[t].begin(), samples[t].end());
+      ret.counters += counters[t];
+      ret.calls += calls[t];
+    }
+    ret.calls_per_sec = (double) ret.calls * 1000000000.0 / (end - begin);
+    return ret;
+  }
+
+  template <class System> inline void sweep(harness::report &out, const config &cfg, const std::vector<std::vector<int>> &patterns)
+  {
+    for(size_t d = 0; d < sizeof(depths) / sizeof(depths[0]) && depths[d] <= cfg.max_depth; d++)
+    {
+      for(size_t r = 0; r < cfg.rates.size(); r++)
+      {
+        double single_threaded = 0;
+        for(auto threads : cfg.threads)
+        {
+          const auto m = time_runner(cfg, runners<System>::value[d], patterns[r], threads);
+          if(threads == 1)
+          {
+            single_threaded = m.calls_per_sec;
+          }
+          out.add("system", System::name).add("value_type", value_traits<typename System::value_type>::name);
+          out.add("depth", depths[d]).add("failure_rate", cfg.rates[r]).add("threads", threads);
+          out.add("ns_per_call", harness::statistics(m.samples));
+          out.add("calls_per_sec", m.calls_per_sec);
+          // NaN is reported as null if there was no single threaded run to compare against
+          out.add("scaling", (single_threaded > 0) ? m.calls_per_sec / (single_threaded * (double) threads) : NAN);
+          out.add("per_call", m.counters, (double) m.calls);
+          out.next_row();
+        }
+      }
+    }
+  }
+  template <template <class> class System, class... Ts> inline void sweep_values(harness::report &out, const config &cfg, const std::vector<std::vector<int>> &patterns)
+  {
+    (void) std::initializer_list<int>{(sweep<System<Ts>>(out, cfg, patterns), 0)...};
+  }
+}  // namespace propagation
+
+int main(int argc, char *argv[])
+{
+  using namespace propagation;
+  static const char extra_usage[] = " [--rates r1,r2,...] [--threads n1,n2,...] [--max-depth N]";
+  config cfg;
+  if(!cfg.opts.parse(argc, argv))
+  {
+    harness::options::usage(argv[0], extra_usage);
+    return 1;
+  }
+  for(size_t n = 0; n < cfg.opts.rest.size(); n++)
+  {
+    const char *arg = cfg.opts.rest[n], *v = (n + 1 < cfg.opts.rest.size()) ? cfg.opts.rest[n + 1] : nullptr;
+    if(0 == strcmp(arg, "--rates") && v != nullptr)
+    {
+      if(!harness::parse_list(cfg.rates, v) || std::any_of(cfg.rates.begin(), cfg.rates.end(), [](double i) { return i < 0 || i > 1; }))
+      {
+        harness::options::usage(argv[0], extra_usage);
+        return 1;
+      }
+      n++;
+    }
+    else if(0 == strcmp(arg, "--threads") && v != nullptr)
+    {
+      if(!harness::parse_list(cfg.threads, v) || std::count(cfg.threads.begin(), cfg.threads.end(), 0) != 0)
+      {
+        harness::options::usage(argv[0], extra_usage);
+        return 1;
+      }
+      n++;
+    }
+    else if(0 == strcmp(arg, "--max-depth") && v != nullptr)
+    {
+      cfg.max_depth = (size_t) atoi(v);
+      n++;
+    }
+    else
+    {
+      harness::options::usage(argv[0], extra_usage);
+      return 1;
+    }
+  }
+  if(!harness::pin_to_cpu(cfg.opts.cpu))
+  {
+    fprintf(stderr, "WARNING: Could not pin to a CPU, results will be noisier\n");
+  }
+  if(!harness::perf_counters().any_available())
+  {
+    fprintf(stderr, "WARNING: No hardware performance counters available, counter columns will be empty\n");
+  }
+  harness::warm_up();
+
+  // Enough calls per pattern that a 0.1% failure rate still sees a hundred failures
+  std::vector<std::vector<int>> patterns;
+  for(auto rate : cfg.rates)
+  {
+    patterns.push_back(failure_pattern(100000, rate));
+  }
+  harness::report out;
+  sweep<integer_returns<int>>(out, cfg, patterns);
+#ifdef __cpp_exceptions
+  sweep_values<exception_throw, int, std::string>(out, cfg, patterns);
+#endif
+  sweep_values<result_error, int, std::string>(out, cfg, patterns);
+  sweep_values<result_excpt, int, std::string>(out, cfg, patterns);
+  sweep_values<outcome_error, int, std::string>(out, cfg, patterns);
+#ifdef BENCHMARK_HAVE_STATUS_RESULT
+  sweep_values<result_exper, int, std::string>(out, cfg, patterns);
+#endif
+  out.write(stdout, cfg.opts.json);
+  return 0;
+}
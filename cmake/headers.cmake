@@ -6,6 +6,7 @@ set(outcome_HEADERS
   "include/outcome/basic_result.hpp"
   "include/outcome/boost_outcome.hpp"
   "include/outcome/boost_result.hpp"
+  "include/outcome/collect.hpp"
   "include/outcome/config.hpp"
   "include/outcome/convert.hpp"
   "include/outcome/coroutine_support.hpp"
@@ -16,12 +17,20 @@ set(outcome_HEADERS
   "include/outcome/detail/basic_result_final.hpp"
   "include/outcome/detail/basic_result_storage.hpp"
   "include/outcome/detail/basic_result_value_observers.hpp"
+  "include/outcome/detail/config_macros.hpp"
   "include/outcome/detail/coroutine_support.ipp"
+  "include/outcome/detail/extern_templates.hpp"
+  "include/outcome/detail/global_module_fragment.hpp"
+  "include/outcome/detail/message_cache.hpp"
   "include/outcome/detail/revision.hpp"
   "include/outcome/detail/trait_std_error_code.hpp"
   "include/outcome/detail/trait_std_exception.hpp"
   "include/outcome/detail/value_storage.hpp"
   "include/outcome/detail/version.hpp"
+  "include/outcome/errno_tables.hpp"
+  "include/outcome/error_channel.hpp"
+  "include/outcome/error_payload.hpp"
+  "include/outcome/experimental/c_thunks.hpp"
   "include/outcome/experimental/coroutine_support.hpp"
   "include/outcome/experimental/result.h"
   "include/outcome/experimental/status-code/include/com_code.hpp"
@@ -50,8 +59,11 @@ set(outcome_HEADERS
   "include/outcome/experimental/status_outcome.hpp"
   "include/outcome/experimental/status_result.hpp"
   "include/outcome/iostream_support.hpp"
+  "include/outcome/message_cache.hpp"
   "include/outcome/outcome.hpp"
   "include/outcome/outcome.natvis"
+  "include/outcome/parallel_collect.hpp"
+  "include/outcome/payload_arena.hpp"
   "include/outcome/policy/all_narrow.hpp"
   "include/outcome/policy/base.hpp"
   "include/outcome/policy/fail_to_compile_observers.hpp"
@@ -62,10 +74,14 @@ set(outcome_HEADERS
   "include/outcome/policy/terminate.hpp"
   "include/outcome/policy/throw_bad_result_access.hpp"
   "include/outcome/result.hpp"
+  "include/outcome/shared_result.hpp"
+  "include/outcome/std_expected.hpp"
   "include/outcome/std_outcome.hpp"
   "include/outcome/std_result.hpp"
   "include/outcome/success_failure.hpp"
   "include/outcome/trait.hpp"
   "include/outcome/try.hpp"
+  "include/outcome/try_macros.hpp"
+  "include/outcome/try_transform_view.hpp"
   "include/outcome/utils.hpp"
 )
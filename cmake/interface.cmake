@@ -6,4 +6,5 @@ set(outcome_INTERFACE
 # DO NOT EDIT, GENERATED BY SCRIPT
 set(outcome_INTERFACE_SOURCE
   "include/outcome.ixx"
+  "include/outcome/experimental.ixx"
 )
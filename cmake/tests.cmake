@@ -2,6 +2,7 @@
 set(outcome_TESTS
   "test/expected-pass.cpp"
   "test/single-header-test.cpp"
+  "test/tests/collect.cpp"
   "test/tests/comparison.cpp"
   "test/tests/constexpr.cpp"
   "test/tests/containers.cpp"
@@ -9,9 +10,15 @@ set(outcome_TESTS
   "test/tests/core-result.cpp"
   "test/tests/coroutine-support.cpp"
   "test/tests/default-construction.cpp"
+  "test/tests/errno-tables.cpp"
+  "test/tests/error-channel.cpp"
+  "test/tests/error-equality.cpp"
+  "test/tests/error-payload.cpp"
+  "test/tests/experimental-c-thunks.cpp"
   "test/tests/experimental-core-outcome-status.cpp"
   "test/tests/experimental-core-result-status.cpp"
   "test/tests/experimental-p0709a.cpp"
+  "test/tests/experimental-small-status-result.cpp"
   "test/tests/fileopen.cpp"
   "test/tests/hooks.cpp"
   "test/tests/issue0007.cpp"
@@ -32,11 +39,17 @@ set(outcome_TESTS
   "test/tests/issue0203.cpp"
   "test/tests/issue0210.cpp"
   "test/tests/issue0220.cpp"
+  "test/tests/message-cache.cpp"
   "test/tests/noexcept-propagation.cpp"
+  "test/tests/parallel-collect.cpp"
+  "test/tests/payload-arena.cpp"
   "test/tests/propagate.cpp"
   "test/tests/serialisation.cpp"
+  "test/tests/shared-result.cpp"
+  "test/tests/std-expected.cpp"
   "test/tests/success-failure.cpp"
   "test/tests/swap.cpp"
+  "test/tests/try-transform-view.cpp"
   "test/tests/udts.cpp"
   "test/tests/value-or-error.cpp"
 )
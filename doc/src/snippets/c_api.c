@@ -39,8 +39,8 @@ Distributed under the Boost Software License, Version 1.0.
 // whenever we reference this type in the future.
 CXX_DECLARE_RESULT_SYSTEM(to_string_rettype, size_t);
 
-// Tell C about our extern C++ function `to_string()`
-extern CXX_RESULT_SYSTEM(to_string_rettype) _Z9to_stringPcmi(char *buffer, size_t bufferlen, int v);
+// Tell C about the thunk `to_string_c()` for our C++ function `to_string()`
+extern CXX_RESULT_SYSTEM(to_string_rettype) to_string_c(char *buffer, size_t bufferlen, int v);
 //! [preamble]
 
 //! [example]
@@ -49,7 +49,7 @@ void print(int v)
   char buffer[4];
   CXX_RESULT_SYSTEM(to_string_rettype) res;
 
-  res = _Z9to_stringPcmi(buffer, sizeof(buffer), v);
+  res = to_string_c(buffer, sizeof(buffer), v);
   if(CXX_RESULT_HAS_VALUE(res))
   {
     printf("to_string(%d) fills buffer with '%s' of %zu characters\n", v, buffer, res.value);
@@ -74,7 +74,7 @@ int main(void)
 }
 //! [example]
 
-extern CXX_RESULT_SYSTEM(to_string_rettype) _Z9to_stringPcmi(char *buffer, size_t bufferlen, int v)
+extern CXX_RESULT_SYSTEM(to_string_rettype) to_string_c(char *buffer, size_t bufferlen, int v)
 {
   // Fake a C++ function so it'll compile and run
   CXX_RESULT_SYSTEM(to_string_rettype) ret;
@@ -25,6 +25,7 @@ Distributed under the Boost Software License, Version 1.0.
 #include <string>
 
 #include "../../../include/outcome/experimental/status-code/include/system_code_from_exception.hpp"
+#include "../../../include/outcome/experimental/c_thunks.hpp"
 #include "../../../include/outcome/experimental/status_result.hpp"
 
 //! [function]
@@ -64,6 +65,15 @@ outcome_e::status_result<size_t> to_string(char *buffer, size_t bufferlen, int v
 }
 //! [function]
 
+//! [thunk]
+// Declare the C struct matching `status_result<size_t>`, as the C code does
+CXX_DECLARE_RESULT_SYSTEM(to_string_rettype, size_t);
+
+// Define `extern "C" to_string_c()`, which calls `to_string()` and returns
+// its result as the C struct
+CXX_DEFINE_RESULT_SYSTEM_THUNK(to_string_rettype, to_string_c, to_string, (char *buffer, size_t bufferlen, int v), (buffer, bufferlen, v))
+//! [thunk]
+
 int main()
 {
   return 0;
@@ -22,10 +22,22 @@ Distributed under the Boost Software License, Version 1.0.
           http://www.boost.org/LICENSE_1_0.txt)
 */
 
-#if defined(__cpp_modules) && !defined(GENERATING_OUTCOME_MODULE_INTERFACE)
-import outcome_v2_0;
+#if defined(OUTCOME_ENABLE_CXX_MODULES) && !defined(GENERATING_OUTCOME_MODULE_INTERFACE)
+#include "outcome/detail/global_module_fragment.hpp"
+#include "outcome/try_macros.hpp"
+import outcome;
 #else
+#include "outcome/collect.hpp"
 #include "outcome/coroutine_support.hpp"
+#include "outcome/errno_tables.hpp"
+#include "outcome/error_channel.hpp"
+#include "outcome/error_payload.hpp"
 #include "outcome/iostream_support.hpp"
+#include "outcome/message_cache.hpp"
+#include "outcome/parallel_collect.hpp"
+#include "outcome/payload_arena.hpp"
+#include "outcome/shared_result.hpp"
+#include "outcome/std_expected.hpp"
 #include "outcome/try.hpp"
+#include "outcome/try_transform_view.hpp"
 #endif
@@ -1,4 +1,44 @@
+/* The outcome C++ 20 module
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Everything Outcome includes from outside itself goes into the global module
+fragment, so it is not attached to this module, and so a translation unit
+which also #includes those headers does not see two definitions of them.
+The Outcome headers then go into the module purview, where their
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN blocks become `export namespace`.
+
+Modules do not export macros, so importers wanting OUTCOME_V2_NAMESPACE or the
+TRY macros should `#include "outcome/try_macros.hpp"`, which has nothing but
+macros in it. Or define OUTCOME_ENABLE_CXX_MODULES and `#include "outcome.hpp"`,
+which does both for you.
+*/
+module;
+
+#include "outcome/detail/global_module_fragment.hpp"
+
+export module outcome;
+
 // Tell the headers we are generating the interface for the library
 #define GENERATING_OUTCOME_MODULE_INTERFACE
-export module outcome_v2_0;  // OUTCOME_MODULE_NAME
 #include "outcome.hpp"
@@ -67,11 +67,11 @@ SIGNATURE NOT RECOGNISED
   /*! AWAITING HUGO JSON CONVERSION TOOL 
 SIGNATURE NOT RECOGNISED
 */
-  const S &&error() const && { return _error; }
+  const S &&error() const && { return static_cast<const S &&>(_error); }
   /*! AWAITING HUGO JSON CONVERSION TOOL 
 SIGNATURE NOT RECOGNISED
 */
-  S &&error() && { return _error; }
+  S &&error() && { return static_cast<S &&>(_error); }
 };
 
 /*! AWAITING HUGO JSON CONVERSION TOOL 
@@ -43,6 +43,31 @@ class basic_outcome;
 
 namespace detail
 {
+  // As result_converting_constructor, but also for the exception converting constructor
+  template <bool implicit_constructors_enabled, class value_type, class error_type, class exception_type, class T> struct outcome_converting_constructor
+  {
+    static constexpr bool not_in_place = false;
+    static constexpr bool to_value = false;
+    static constexpr bool to_error = false;
+    static constexpr bool to_exception = false;
+    static constexpr bool enable_value = false;
+    static constexpr bool enable_error = false;
+    static constexpr bool enable_exception = false;
+  };
+  template <class value_type, class error_type, class exception_type, class T>
+  struct outcome_converting_constructor<true, value_type, error_type, exception_type, T>
+  {
+    using result = result_converting_constructor<true, value_type, error_type, T>;
+    static constexpr bool not_in_place = result::not_in_place;
+    static constexpr bool to_value = result::to_value;
+    static constexpr bool to_error = result::to_error;
+    static constexpr bool to_exception = detail::is_implicitly_constructible<exception_type, T>;
+    // deliberately less tolerant of ambiguity than result's edition
+    static constexpr bool enable_value = result::enable_value && !to_exception;
+    static constexpr bool enable_error = result::enable_error && !to_exception;
+    static constexpr bool enable_exception = not_in_place && !to_value && !to_error && to_exception;
+  };
+
   // May be reused by basic_outcome subclasses to save load on the compiler
   template <class value_type, class error_type, class exception_type> struct outcome_predicates
   {
@@ -56,19 +81,14 @@ namespace detail
     && !detail::is_implicitly_constructible<exception_type, value_type>  //
     && !detail::is_implicitly_constructible<exception_type, error_type>;
 
+    template <class T, bool enabled = true>
+    using converting_constructor = outcome_converting_constructor<enabled && implicit_constructors_enabled, value_type, error_type, exception_type, T>;
+
     // Predicate for the value converting constructor to be available.
-    template <class T>
-    static constexpr bool enable_value_converting_constructor =  //
-    implicit_constructors_enabled                                //
-    &&result::template enable_value_converting_constructor<T>    //
-    && !detail::is_implicitly_constructible<exception_type, T>;  // deliberately less tolerant of ambiguity than result's edition
+    template <class T> static constexpr bool enable_value_converting_constructor = converting_constructor<T>::enable_value;
 
     // Predicate for the error converting constructor to be available.
-    template <class T>
-    static constexpr bool enable_error_converting_constructor =  //
-    implicit_constructors_enabled                                //
-    &&result::template enable_error_converting_constructor<T>    //
-    && !detail::is_implicitly_constructible<exception_type, T>;  // deliberately less tolerant of ambiguity than result's edition
+    template <class T> static constexpr bool enable_error_converting_constructor = converting_constructor<T>::enable_error;
 
     // Predicate for the error condition converting constructor to be available.
     template <class ErrorCondEnum>
@@ -76,30 +96,21 @@ namespace detail
                                                                           && !detail::is_implicitly_constructible<exception_type, ErrorCondEnum>;
 
     // Predicate for the exception converting constructor to be available.
-    template <class T>
-    static constexpr bool enable_exception_converting_constructor =  //
-    implicit_constructors_enabled                                    //
-    && !is_in_place_type_t<std::decay_t<T>>::value                   // not in place construction
-    && !detail::is_implicitly_constructible<value_type, T> && !detail::is_implicitly_constructible<error_type, T> &&
-    detail::is_implicitly_constructible<exception_type, T>;
+    template <class T> static constexpr bool enable_exception_converting_constructor = converting_constructor<T>::enable_exception;
 
     // Predicate for the error + exception converting constructor to be available.
     template <class T, class U>
-    static constexpr bool enable_error_exception_converting_constructor =                                         //
-    implicit_constructors_enabled                                                                                 //
-    && !is_in_place_type_t<std::decay_t<T>>::value                                                                // not in place construction
-    && !detail::is_implicitly_constructible<value_type, T> && detail::is_implicitly_constructible<error_type, T>  //
-    && !detail::is_implicitly_constructible<value_type, U> && detail::is_implicitly_constructible<exception_type, U>;
+    static constexpr bool enable_error_exception_converting_constructor =                  //
+    converting_constructor<T>::not_in_place                                                // not in place construction
+    && !converting_constructor<T>::to_value && converting_constructor<T>::to_error         //
+    && !converting_constructor<U>::to_value && converting_constructor<U>::to_exception;
 
     // Predicate for the converting copy constructor from a compatible outcome to be available.
     template <class T, class U, class V, class W>
     static constexpr bool enable_compatible_conversion =  //
-    (std::is_void<T>::value ||
-     detail::is_explicitly_constructible<value_type, typename basic_outcome<T, U, V, W>::value_type>)  // if our value types are constructible
-    &&(std::is_void<U>::value ||
-       detail::is_explicitly_constructible<error_type, typename basic_outcome<T, U, V, W>::error_type>)  // if our error types are constructible
-    &&(std::is_void<V>::value ||
-       detail::is_explicitly_constructible<exception_type, typename basic_outcome<T, U, V, W>::exception_type>)  // if our exception types are constructible
+    (std::is_void<T>::value || detail::is_explicitly_constructible<value_type, T>)          // if our value types are constructible
+    && (std::is_void<U>::value || detail::is_explicitly_constructible<error_type, U>)      // if our error types are constructible
+    && (std::is_void<V>::value || detail::is_explicitly_constructible<exception_type, V>)  // if our exception types are constructible
     ;
 
     // Predicate for the converting constructor from a make_error_code() of the input to be available.
@@ -107,34 +118,23 @@ namespace detail
     static constexpr bool enable_make_error_code_compatible_conversion =  //
     trait::is_error_code_available<std::decay_t<error_type>>::value       // if error type has an error code
     && !enable_compatible_conversion<T, U, V, W>                          // and the normal compatible conversion is not available
-    && (std::is_void<T>::value ||
-        detail::is_explicitly_constructible<value_type, typename basic_outcome<T, U, V, W>::value_type>)  // and if our value types are constructible
-    &&detail::is_explicitly_constructible<error_type,
-                                          typename trait::is_error_code_available<U>::type>  // and our error type is constructible from a make_error_code()
-    && (std::is_void<V>::value ||
-        detail::is_explicitly_constructible<exception_type, typename basic_outcome<T, U, V, W>::exception_type>);  // and our exception types are constructible
+    && (std::is_void<T>::value || detail::is_explicitly_constructible<value_type, T>)  // and if our value types are constructible
+    && detail::is_explicitly_constructible<error_type,
+                                           typename trait::is_error_code_available<U>::type>  // and our error type is constructible from a make_error_code()
+    && (std::is_void<V>::value || detail::is_explicitly_constructible<exception_type, V>);  // and our exception types are constructible
 
     // Predicate for the implicit converting inplace constructor from a compatible input to be available.
     struct disable_inplace_value_error_exception_constructor;
     template <class... Args>
-    using choose_inplace_value_error_exception_constructor = std::conditional_t<  //
-    ((static_cast<int>(std::is_constructible<value_type, Args...>::value) + static_cast<int>(std::is_constructible<error_type, Args...>::value) +
-      static_cast<int>(std::is_constructible<exception_type, Args...>::value)) > 1),  //
-    disable_inplace_value_error_exception_constructor,                                //
-    std::conditional_t<                                                               //
-    std::is_constructible<value_type, Args...>::value,                                //
-    value_type,                                                                       //
-    std::conditional_t<                                                               //
-    std::is_constructible<error_type, Args...>::value,                                //
-    error_type,                                                                       //
-    std::conditional_t<                                                               //
-    std::is_constructible<exception_type, Args...>::value,                            //
-    exception_type,                                                                   //
-    disable_inplace_value_error_exception_constructor>>>>;
+    using choose_inplace_value_error_exception_constructor =
+    typename choose_inplace_constructor<OUTCOME_IS_CONSTRUCTIBLE(value_type, Args...), OUTCOME_IS_CONSTRUCTIBLE(error_type, Args...),
+                                        OUTCOME_IS_CONSTRUCTIBLE(exception_type, Args...)>::template type<value_type, error_type, exception_type,
+                                                                                                          disable_inplace_value_error_exception_constructor>;
     template <class... Args>
     static constexpr bool enable_inplace_value_error_exception_constructor =  //
-    implicit_constructors_enabled &&
-    !std::is_same<choose_inplace_value_error_exception_constructor<Args...>, disable_inplace_value_error_exception_constructor>::value;
+    implicit_constructors_enabled                                             //
+    && (static_cast<int>(OUTCOME_IS_CONSTRUCTIBLE(value_type, Args...)) + static_cast<int>(OUTCOME_IS_CONSTRUCTIBLE(error_type, Args...)) +
+        static_cast<int>(OUTCOME_IS_CONSTRUCTIBLE(exception_type, Args...))) == 1;  // exactly one of them is constructible
   };
 
   // Select whether to use basic_outcome_failure_observers or not
@@ -154,6 +154,18 @@ namespace detail
     return static_cast<failure_type<U, void> &&>(v).error();
   }
 
+  // A failure_type with both an error and an exception constructs only those present, so default construct the others
+  template <class T, class U, class V> constexpr inline T extract_error_from_failure_or_default(const failure_type<U, V> &v) { return v.has_error() ? T(v.error()) : T(); }
+  template <class T, class U, class V> constexpr inline T extract_error_from_failure_or_default(failure_type<U, V> &&v)
+  {
+    return v.has_error() ? T(static_cast<failure_type<U, V> &&>(v).error()) : T();
+  }
+  template <class T, class U, class V> constexpr inline T extract_exception_from_failure_or_default(const failure_type<U, V> &v) { return v.has_exception() ? T(v.exception()) : T(); }
+  template <class T, class U, class V> constexpr inline T extract_exception_from_failure_or_default(failure_type<U, V> &&v)
+  {
+    return v.has_exception() ? T(static_cast<failure_type<U, V> &&>(v).exception()) : T();
+  }
+
   template <class T> struct is_basic_outcome
   {
     static constexpr bool value = false;
@@ -171,7 +183,7 @@ template <class T> using is_basic_outcome = detail::is_basic_outcome<std::decay_
 /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
-template <class T> static constexpr bool is_basic_outcome_v = detail::is_basic_outcome<std::decay_t<T>>::value;
+template <class T> OUTCOME_INLINE_VARIABLE constexpr bool is_basic_outcome_v = detail::is_basic_outcome<std::decay_t<T>>::value;
 
 namespace hooks
 {
@@ -301,19 +313,16 @@ protected:
     // Predicate for implicit constructors to be available at all
     static constexpr bool implicit_constructors_enabled = constructors_enabled && base::implicit_constructors_enabled;
 
-    // Predicate for the value converting constructor to be available.
+    // Predicate for the value, error and exception converting constructors to consider T at all. When not, nothing more about T is evaluated.
     template <class T>
-    static constexpr bool enable_value_converting_constructor =  //
-    constructors_enabled                                         //
-    && !std::is_same<std::decay_t<T>, basic_outcome>::value      // not my type
-    && base::template enable_value_converting_constructor<T>;
+    using converting_constructor = typename base::template converting_constructor<T, constructors_enabled                                  //
+                                                                                    && !std::is_same<std::decay_t<T>, basic_outcome>::value>;  // not my type
+
+    // Predicate for the value converting constructor to be available.
+    template <class T> static constexpr bool enable_value_converting_constructor = converting_constructor<T>::enable_value;
 
     // Predicate for the error converting constructor to be available.
-    template <class T>
-    static constexpr bool enable_error_converting_constructor =  //
-    constructors_enabled                                         //
-    && !std::is_same<std::decay_t<T>, basic_outcome>::value      // not my type
-    && base::template enable_error_converting_constructor<T>;
+    template <class T> static constexpr bool enable_error_converting_constructor = converting_constructor<T>::enable_error;
 
     // Predicate for the error condition converting constructor to be available.
     template <class ErrorCondEnum>
@@ -323,11 +332,7 @@ protected:
     && base::template enable_error_condition_converting_constructor<ErrorCondEnum>;
 
     // Predicate for the exception converting constructor to be available.
-    template <class T>
-    static constexpr bool enable_exception_converting_constructor =  //
-    constructors_enabled                                             //
-    && !std::is_same<std::decay_t<T>, basic_outcome>::value          // not my type
-    && base::template enable_exception_converting_constructor<T>;
+    template <class T> static constexpr bool enable_exception_converting_constructor = converting_constructor<T>::enable_exception;
 
     // Predicate for the error + exception converting constructor to be available.
     template <class T, class U>
@@ -355,21 +360,21 @@ protected:
     static constexpr bool enable_inplace_value_constructor =  //
     constructors_enabled                                      //
     && (std::is_void<value_type>::value                       //
-        || std::is_constructible<value_type, Args...>::value);
+        || OUTCOME_IS_CONSTRUCTIBLE(value_type, Args...));
 
     // Predicate for the inplace construction of error to be available.
     template <class... Args>
     static constexpr bool enable_inplace_error_constructor =  //
     constructors_enabled                                      //
     && (std::is_void<error_type>::value                       //
-        || std::is_constructible<error_type, Args...>::value);
+        || OUTCOME_IS_CONSTRUCTIBLE(error_type, Args...));
 
     // Predicate for the inplace construction of exception to be available.
     template <class... Args>
     static constexpr bool enable_inplace_exception_constructor =  //
     constructors_enabled                                          //
     && (std::is_void<exception_type>::value                       //
-        || std::is_constructible<exception_type, Args...>::value);
+        || OUTCOME_IS_CONSTRUCTIBLE(exception_type, Args...));
 
     // Predicate for the implicit converting inplace constructor to be available.
     template <class... Args>
@@ -760,8 +765,8 @@ SIGNATURE NOT RECOGNISED
   OUTCOME_TREQUIRES(OUTCOME_TPRED(!std::is_void<U>::value && predicate::template enable_compatible_conversion<void, T, U, void>))
   constexpr basic_outcome(const failure_type<T, U> &o, explicit_compatible_copy_conversion_tag /*unused*/ = explicit_compatible_copy_conversion_tag()) noexcept(
   std::is_nothrow_constructible<error_type, T>::value &&std::is_nothrow_constructible<exception_type, U>::value)  // NOLINT
-      : base{in_place_type<typename base::_error_type>, detail::extract_error_from_failure<error_type>(o)}
-      , _ptr(detail::extract_exception_from_failure<exception_type>(o))
+      : base{in_place_type<typename base::_error_type>, detail::extract_error_from_failure_or_default<error_type>(o)}
+      , _ptr(detail::extract_exception_from_failure_or_default<exception_type>(o))
   {
     if(!o.has_error())
     {
@@ -823,8 +828,8 @@ SIGNATURE NOT RECOGNISED
   OUTCOME_TREQUIRES(OUTCOME_TPRED(!std::is_void<U>::value && predicate::template enable_compatible_conversion<void, T, U, void>))
   constexpr basic_outcome(failure_type<T, U> &&o, explicit_compatible_move_conversion_tag /*unused*/ = explicit_compatible_move_conversion_tag()) noexcept(
   std::is_nothrow_constructible<error_type, T>::value &&std::is_nothrow_constructible<exception_type, U>::value)  // NOLINT
-      : base{in_place_type<typename base::_error_type>, detail::extract_error_from_failure<error_type>(static_cast<failure_type<T, U> &&>(o))}
-      , _ptr(detail::extract_exception_from_failure<exception_type>(static_cast<failure_type<T, U> &&>(o)))
+      : base{in_place_type<typename base::_error_type>, detail::extract_error_from_failure_or_default<error_type>(static_cast<failure_type<T, U> &&>(o))}
+      , _ptr(detail::extract_exception_from_failure_or_default<exception_type>(static_cast<failure_type<T, U> &&>(o)))
   {
     if(!o.has_error())
     {
@@ -840,6 +845,34 @@ SIGNATURE NOT RECOGNISED
 
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class... Args)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_value_constructor<Args...>))
+  constexpr basic_outcome(success_ref_type<Args...> &&o) noexcept(std::is_nothrow_constructible<value_type, Args...>::value)  // NOLINT
+      : basic_outcome(detail::forwarded_args_tag(), in_place_type<value_type_if_enabled>, static_cast<std::tuple<Args &&...> &&>(o.args()), std::index_sequence_for<Args...>())
+  {
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class... Args)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_error_constructor<Args...>))
+  constexpr basic_outcome(failure_ref_type<Args...> &&o) noexcept(std::is_nothrow_constructible<error_type, Args...>::value)  // NOLINT
+      : basic_outcome(detail::forwarded_args_tag(), in_place_type<error_type_if_enabled>, static_cast<std::tuple<Args &&...> &&>(o.args()), std::index_sequence_for<Args...>())
+  {
+  }
+
+private:
+  // Unpacks the arguments of success_ref() and failure_ref() into the in place constructors
+  template <class T, class Tuple, size_t... Is>
+  constexpr basic_outcome(detail::forwarded_args_tag /*unused*/, in_place_type_t<T> _, Tuple &&args, std::index_sequence<Is...> /*unused*/)
+      : basic_outcome(_, std::get<Is>(static_cast<Tuple &&>(args))...)
+  {
+  }
+
+public:
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
 */
   using base::operator==;
   using base::operator!=;
@@ -862,11 +895,11 @@ SIGNATURE NOT RECOGNISED
     if(this->_state._status.have_error() && o._state._status.have_error()  //
        && this->_state._status.have_exception() && o._state._status.have_exception())
     {
-      return this->_error == o._error && this->_ptr == o._ptr;
+      return _error_equal(this->_state, this->_error, o._error) && this->_ptr == o._ptr;
     }
     if(this->_state._status.have_error() && o._state._status.have_error())
     {
-      return this->_error == o._error;
+      return _error_equal(this->_state, this->_error, o._error);
     }
     if(this->_state._status.have_exception() && o._state._status.have_exception())
     {
@@ -883,16 +916,16 @@ SIGNATURE NOT RECOGNISED
   constexpr bool operator==(const failure_type<T, U> &o) const noexcept(  //
   noexcept(std::declval<error_type>() == std::declval<T>()) && noexcept(std::declval<exception_type>() == std::declval<U>()))
   {
-    if(this->_state._status.have_error() && o._state._status.have_error()  //
-       && this->_state._status.have_exception() && o._state._status.have_exception())
+    if(this->_state._status.have_error() && o.has_error()  //
+       && this->_state._status.have_exception() && o.has_exception())
     {
-      return this->_error == o.error() && this->_ptr == o.exception();
+      return _error_equal(this->_state, this->_error, o.error()) && this->_ptr == o.exception();
     }
-    if(this->_state._status.have_error() && o._state._status.have_error())
+    if(this->_state._status.have_error() && o.has_error())
     {
-      return this->_error == o.error();
+      return _error_equal(this->_state, this->_error, o.error());
     }
-    if(this->_state._status.have_exception() && o._state._status.have_exception())
+    if(this->_state._status.have_exception() && o.has_exception())
     {
       return this->_ptr == o.exception();
     }
@@ -917,11 +950,11 @@ SIGNATURE NOT RECOGNISED
     if(this->_state._status.have_error() && o._state._status.have_error()  //
        && this->_state._status.have_exception() && o._state._status.have_exception())
     {
-      return this->_error != o._error || this->_ptr != o._ptr;
+      return _error_not_equal(this->_state, this->_error, o._error) || this->_ptr != o._ptr;
     }
     if(this->_state._status.have_error() && o._state._status.have_error())
     {
-      return this->_error != o._error;
+      return _error_not_equal(this->_state, this->_error, o._error);
     }
     if(this->_state._status.have_exception() && o._state._status.have_exception())
     {
@@ -938,16 +971,16 @@ SIGNATURE NOT RECOGNISED
   constexpr bool operator!=(const failure_type<T, U> &o) const noexcept(  //
   noexcept(std::declval<error_type>() == std::declval<T>()) && noexcept(std::declval<exception_type>() == std::declval<U>()))
   {
-    if(this->_state._status.have_error() && o._state._status.have_error()  //
-       && this->_state._status.have_exception() && o._state._status.have_exception())
+    if(this->_state._status.have_error() && o.has_error()  //
+       && this->_state._status.have_exception() && o.has_exception())
     {
-      return this->_error != o.error() || this->_ptr != o.exception();
+      return _error_not_equal(this->_state, this->_error, o.error()) || this->_ptr != o.exception();
     }
-    if(this->_state._status.have_error() && o._state._status.have_error())
+    if(this->_state._status.have_error() && o.has_error())
     {
-      return this->_error != o.error();
+      return _error_not_equal(this->_state, this->_error, o.error());
     }
-    if(this->_state._status.have_exception() && o._state._status.have_exception())
+    if(this->_state._status.have_exception() && o.has_exception())
     {
       return this->_ptr != o.exception();
     }
@@ -44,6 +44,54 @@ class basic_result;
 
 namespace detail
 {
+  /* Chooses which of the value, error or exception types an in place constructor
+  from some args would construct, being the one and only one constructible from them.
+  One template specialised on the constructibility of each replaces a chain of nested
+  std::conditional_t, so each distinct set of args costs a single instantiation.
+  */
+  template <bool value, bool error, bool exception> struct choose_inplace_constructor
+  {
+    template <class V, class E, class X, class Disable> using type = Disable;
+  };
+  template <> struct choose_inplace_constructor<true, false, false>
+  {
+    template <class V, class E, class X, class Disable> using type = V;
+  };
+  template <> struct choose_inplace_constructor<false, true, false>
+  {
+    template <class V, class E, class X, class Disable> using type = E;
+  };
+  template <> struct choose_inplace_constructor<false, false, true>
+  {
+    template <class V, class E, class X, class Disable> using type = X;
+  };
+
+  /* Everything the value and error converting constructors need to know about T.
+  Overload resolution asks this of every constructor for every argument type, so it
+  is computed once per T and shared by all of them (and by basic_outcome), and not
+  at all if implicit construction is disabled.
+  */
+  template <bool implicit_constructors_enabled, class value_type, class error_type, class T> struct result_converting_constructor
+  {
+    static constexpr bool not_in_place = false;
+    static constexpr bool to_value = false;
+    static constexpr bool to_error = false;
+    static constexpr bool enable_value = false;
+    static constexpr bool enable_error = false;
+  };
+  template <class value_type, class error_type, class T> struct result_converting_constructor<true, value_type, error_type, T>
+  {
+    static constexpr bool not_in_place = !is_in_place_type_t<std::decay_t<T>>::value;
+    static constexpr bool to_value = detail::is_implicitly_constructible<value_type, T>;
+    static constexpr bool to_error = detail::is_implicitly_constructible<error_type, T>;
+    static constexpr bool candidate = not_in_place                                                // not in place construction
+                                      && !trait::is_error_type_enum<error_type, std::decay_t<T>>::value;  // not an enum valid for my error type
+    // is unambiguously for value type, OR is my value type exactly
+    static constexpr bool enable_value = candidate && to_value && (!to_error || std::is_same<value_type, std::decay_t<T>>::value);
+    // is unambiguously for error type, OR is my error type exactly
+    static constexpr bool enable_error = candidate && to_error && (!to_value || std::is_same<error_type, std::decay_t<T>>::value);
+  };
+
   // These are reused by basic_outcome to save load on the compiler
   template <class value_type, class error_type> struct result_predicates
   {
@@ -57,27 +105,14 @@ namespace detail
             && !detail::is_implicitly_constructible<error_type, value_type>  // AND which cannot be constructed from the value type
             && std::is_integral<value_type>::value));                        // AND the value type is some integral type
 
-    // Predicate for the value converting constructor to be available. Weakened to allow result<int, C enum>.
-    template <class T>
-    static constexpr bool enable_value_converting_constructor =                                                      //
-    implicit_constructors_enabled                                                                                    //
-    && !is_in_place_type_t<std::decay_t<T>>::value                                                                   // not in place construction
-    && !trait::is_error_type_enum<error_type, std::decay_t<T>>::value                                                // not an enum valid for my error type
-    && ((detail::is_implicitly_constructible<value_type, T> && !detail::is_implicitly_constructible<error_type, T>)  // is unambiguously for value type
-        || (std::is_same<value_type, std::decay_t<T>>::value                                                         // OR is my value type exactly
-            && detail::is_implicitly_constructible<value_type, T>) );  // and my value type is constructible from this ref form of T
+    template <class T, bool enabled = true>
+    using converting_constructor = result_converting_constructor<enabled && implicit_constructors_enabled, value_type, error_type, T>;
 
+    // Predicate for the value converting constructor to be available. Weakened to allow result<int, C enum>.
+    template <class T> static constexpr bool enable_value_converting_constructor = converting_constructor<T>::enable_value;
 
     // Predicate for the error converting constructor to be available. Weakened to allow result<int, C enum>.
-    template <class T>
-    static constexpr bool enable_error_converting_constructor =                                                      //
-    implicit_constructors_enabled                                                                                    //
-    && !is_in_place_type_t<std::decay_t<T>>::value                                                                   // not in place construction
-    && !trait::is_error_type_enum<error_type, std::decay_t<T>>::value                                                // not an enum valid for my error type
-    && ((!detail::is_implicitly_constructible<value_type, T> && detail::is_implicitly_constructible<error_type, T>)  // is unambiguously for error type
-        || (std::is_same<error_type, std::decay_t<T>>::value                                                         // OR is my error type exactly
-            && detail::is_implicitly_constructible<error_type, T>) );  // and my error type is constructible from this ref form of T
-
+    template <class T> static constexpr bool enable_error_converting_constructor = converting_constructor<T>::enable_error;
     // Predicate for the error condition converting constructor to be available.
     template <class ErrorCondEnum>
     static constexpr bool enable_error_condition_converting_constructor =         //
@@ -91,10 +126,8 @@ namespace detail
     // Predicate for the converting constructor from a compatible input to be available.
     template <class T, class U, class V>
     static constexpr bool enable_compatible_conversion =  //
-    (std::is_void<T>::value ||
-     detail::is_explicitly_constructible<value_type, typename basic_result<T, U, V>::value_type>)  // if our value types are constructible
-    &&(std::is_void<U>::value ||
-       detail::is_explicitly_constructible<error_type, typename basic_result<T, U, V>::error_type>)  // if our error types are constructible
+    (std::is_void<T>::value || detail::is_explicitly_constructible<value_type, T>)     // if our value types are constructible
+    && (std::is_void<U>::value || detail::is_explicitly_constructible<error_type, U>)  // if our error types are constructible
     ;
 
     // Predicate for the converting constructor from a make_error_code() of the input to be available.
@@ -102,38 +135,29 @@ namespace detail
     static constexpr bool enable_make_error_code_compatible_conversion =  //
     trait::is_error_code_available<std::decay_t<error_type>>::value       // if error type has an error code
     && !enable_compatible_conversion<T, U, V>                             // and the normal compatible conversion is not available
-    && (std::is_void<T>::value ||
-        detail::is_explicitly_constructible<value_type, typename basic_result<T, U, V>::value_type>)  // and if our value types are constructible
-    &&detail::is_explicitly_constructible<error_type,
-                                          typename trait::is_error_code_available<U>::type>;  // and our error type is constructible from a make_error_code()
+    && (std::is_void<T>::value || detail::is_explicitly_constructible<value_type, T>)  // and if our value types are constructible
+    && detail::is_explicitly_constructible<error_type,
+                                           typename trait::is_error_code_available<U>::type>;  // and our error type is constructible from a make_error_code()
 
     // Predicate for the converting constructor from a make_exception_ptr() of the input to be available.
     template <class T, class U, class V>
     static constexpr bool enable_make_exception_ptr_compatible_conversion =  //
     trait::is_exception_ptr_available<std::decay_t<error_type>>::value       // if error type has an exception ptr
     && !enable_compatible_conversion<T, U, V>                                // and the normal compatible conversion is not available
-    && (std::is_void<T>::value ||
-        detail::is_explicitly_constructible<value_type, typename basic_result<T, U, V>::value_type>)         // and if our value types are constructible
-    &&detail::is_explicitly_constructible<error_type, typename trait::is_exception_ptr_available<U>::type>;  // and our error type is constructible from a
-                                                                                                             // make_exception_ptr()
+    && (std::is_void<T>::value || detail::is_explicitly_constructible<value_type, T>)  // and if our value types are constructible
+    && detail::is_explicitly_constructible<error_type, typename trait::is_exception_ptr_available<U>::type>;  // and our error type is constructible from a
+                                                                                                              // make_exception_ptr()
 
     // Predicate for the implicit converting inplace constructor from a compatible input to be available.
     struct disable_inplace_value_error_constructor;
     template <class... Args>
-    using choose_inplace_value_error_constructor = std::conditional_t<                                       //
-    std::is_constructible<value_type, Args...>::value && std::is_constructible<error_type, Args...>::value,  //
-    disable_inplace_value_error_constructor,                                                                 //
-    std::conditional_t<                                                                                      //
-    std::is_constructible<value_type, Args...>::value,                                                       //
-    value_type,                                                                                              //
-    std::conditional_t<                                                                                      //
-    std::is_constructible<error_type, Args...>::value,                                                       //
-    error_type,                                                                                              //
-    disable_inplace_value_error_constructor>>>;
+    using choose_inplace_value_error_constructor =
+    typename choose_inplace_constructor<OUTCOME_IS_CONSTRUCTIBLE(value_type, Args...), OUTCOME_IS_CONSTRUCTIBLE(error_type, Args...),
+                                        false>::template type<value_type, error_type, void, disable_inplace_value_error_constructor>;
     template <class... Args>
-    static constexpr bool enable_inplace_value_error_constructor =
-    implicit_constructors_enabled  //
-    && !std::is_same<choose_inplace_value_error_constructor<Args...>, disable_inplace_value_error_constructor>::value;
+    static constexpr bool enable_inplace_value_error_constructor =  //
+    implicit_constructors_enabled                                   //
+    && OUTCOME_IS_CONSTRUCTIBLE(value_type, Args...) != OUTCOME_IS_CONSTRUCTIBLE(error_type, Args...);  // exactly one of them is constructible
   };
 
   template <class T, class U> constexpr inline const U &extract_value_from_success(const success_type<U> &v) { return v.value(); }
@@ -164,7 +188,7 @@ template <class T> using is_basic_result = detail::is_basic_result<std::decay_t<
 /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
-template <class T> static constexpr bool is_basic_result_v = detail::is_basic_result<std::decay_t<T>>::value;
+template <class T> OUTCOME_INLINE_VARIABLE constexpr bool is_basic_result_v = detail::is_basic_result<std::decay_t<T>>::value;
 
 /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
@@ -278,19 +302,16 @@ protected:
     // Predicate for implicit constructors to be available at all
     static constexpr bool implicit_constructors_enabled = constructors_enabled && base::implicit_constructors_enabled;
 
-    // Predicate for the value converting constructor to be available.
+    // Predicate for the value and error converting constructors to consider T at all. When not, nothing more about T is evaluated.
     template <class T>
-    static constexpr bool enable_value_converting_constructor =  //
-    constructors_enabled                                         //
-    && !std::is_same<std::decay_t<T>, basic_result>::value       // not my type
-    && base::template enable_value_converting_constructor<T>;
+    using converting_constructor = typename base::template converting_constructor<T, constructors_enabled                                 //
+                                                                                    && !std::is_same<std::decay_t<T>, basic_result>::value>;  // not my type
+
+    // Predicate for the value converting constructor to be available.
+    template <class T> static constexpr bool enable_value_converting_constructor = converting_constructor<T>::enable_value;
 
     // Predicate for the error converting constructor to be available.
-    template <class T>
-    static constexpr bool enable_error_converting_constructor =  //
-    constructors_enabled                                         //
-    && !std::is_same<std::decay_t<T>, basic_result>::value       // not my type
-    && base::template enable_error_converting_constructor<T>;
+    template <class T> static constexpr bool enable_error_converting_constructor = converting_constructor<T>::enable_error;
 
     // Predicate for the error condition converting constructor to be available.
     template <class ErrorCondEnum>
@@ -325,14 +346,14 @@ protected:
     static constexpr bool enable_inplace_value_constructor =  //
     constructors_enabled                                      //
     && (std::is_void<value_type>::value                       //
-        || std::is_constructible<value_type, Args...>::value);
+        || OUTCOME_IS_CONSTRUCTIBLE(value_type, Args...));
 
     // Predicate for the inplace construction of error to be available.
     template <class... Args>
     static constexpr bool enable_inplace_error_constructor =  //
     constructors_enabled                                      //
     && (std::is_void<error_type>::value                       //
-        || std::is_constructible<error_type, Args...>::value);
+        || OUTCOME_IS_CONSTRUCTIBLE(error_type, Args...));
 
     // Predicate for the implicit converting inplace constructor to be available.
     template <class... Args>
@@ -688,6 +709,34 @@ SIGNATURE NOT RECOGNISED
 
   /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class... Args)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_value_constructor<Args...>))
+  constexpr basic_result(success_ref_type<Args...> &&o) noexcept(std::is_nothrow_constructible<value_type, Args...>::value)  // NOLINT
+      : basic_result(detail::forwarded_args_tag(), in_place_type<value_type_if_enabled>, static_cast<std::tuple<Args &&...> &&>(o.args()), std::index_sequence_for<Args...>())
+  {
+  }
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  OUTCOME_TEMPLATE(class... Args)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(predicate::template enable_inplace_error_constructor<Args...>))
+  constexpr basic_result(failure_ref_type<Args...> &&o) noexcept(std::is_nothrow_constructible<error_type, Args...>::value)  // NOLINT
+      : basic_result(detail::forwarded_args_tag(), in_place_type<error_type_if_enabled>, static_cast<std::tuple<Args &&...> &&>(o.args()), std::index_sequence_for<Args...>())
+  {
+  }
+
+private:
+  // Unpacks the arguments of success_ref() and failure_ref() into the in place constructors
+  template <class T, class Tuple, size_t... Is>
+  constexpr basic_result(detail::forwarded_args_tag /*unused*/, in_place_type_t<T> _, Tuple &&args, std::index_sequence<Is...> /*unused*/)
+      : basic_result(_, std::get<Is>(static_cast<Tuple &&>(args))...)
+  {
+  }
+
+public:
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
 */
   constexpr void swap(basic_result &o) noexcept((std::is_void<value_type>::value || detail::is_nothrow_swappable<value_type>::value)  //
                                                 && (std::is_void<error_type>::value || detail::is_nothrow_swappable<error_type>::value))
@@ -0,0 +1,187 @@
+/* Collecting ranges of results into a result of a container
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_COLLECT_HPP
+#define OUTCOME_COLLECT_HPP
+
+#include "basic_result.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+template <class R, class S, class P, class NoValuePolicy>  //
+class basic_outcome;
+
+namespace detail
+{
+  // The policies are templated on the value type, so are rebound with it where they can be
+  template <class NoValuePolicy, class From, class To> struct collect_rebind_policy
+  {
+    using type = NoValuePolicy;
+  };
+  template <template <class...> class NoValuePolicy, class From, class... Args, class To> struct collect_rebind_policy<NoValuePolicy<From, Args...>, From, To>
+  {
+    using type = NoValuePolicy<To, Args...>;
+  };
+  template <class R, class T> struct collect_rebind;
+  template <class R, class S, class NoValuePolicy, class T> struct collect_rebind<basic_result<R, S, NoValuePolicy>, T>
+  {
+    using type = basic_result<T, S, typename collect_rebind_policy<NoValuePolicy, R, T>::type>;
+  };
+  template <class R, class S, class P, class NoValuePolicy, class T> struct collect_rebind<basic_outcome<R, S, P, NoValuePolicy>, T>
+  {
+    using type = basic_outcome<T, S, P, typename collect_rebind_policy<NoValuePolicy, R, T>::type>;
+  };
+  template <class R, class T> using collect_rebind_t = typename collect_rebind<R, T>::type;
+
+  template <class Range> using collect_element_type = std::decay_t<decltype(*std::begin(std::declval<Range &>()))>;
+  template <class Range> using collect_failure_type = decltype(std::declval<collect_element_type<Range> &&>().as_failure());
+  // Elements are moved out of rvalue ranges, and of ranges yielding prvalues, else copied
+  template <class Range, class Ref>
+  using collect_reference =
+  std::conditional_t<std::is_lvalue_reference<Range>::value && std::is_lvalue_reference<Ref>::value, const std::decay_t<Ref> &, std::decay_t<Ref> &&>;
+
+  template <class Range> constexpr auto collect_size(const Range &r, int /*unused*/) -> decltype(static_cast<size_t>(r.size())) { return static_cast<size_t>(r.size()); }
+  template <class T, size_t N> constexpr size_t collect_size(const T (& /*unused*/)[N], int /*unused*/) { return N; }
+  template <class Range> constexpr size_t collect_size(const Range & /*unused*/, ... /*unused*/) { return 0; }
+
+  template <class Container> auto collect_reserve(Container &c, size_t n, int /*unused*/) -> decltype(c.reserve(n), void())
+  {
+    if(n > 0)
+    {
+      c.reserve(c.size() + n);
+    }
+  }
+  template <class Container> void collect_reserve(Container & /*unused*/, size_t /*unused*/, ... /*unused*/) {}
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+/* Appends the values of a range of `basic_result` or `basic_outcome` to `out`,
+stopping at the first failure, which is returned. `out` is reserved up front
+if the range knows its size, so a `std::vector` allocates once. Values are
+moved out if the range is an rvalue, otherwise copied. The values before the
+failure remain appended to `out`.
+*/
+OUTCOME_TEMPLATE(class Range, class Container, class R = detail::collect_element_type<Range>)
+OUTCOME_TREQUIRES(OUTCOME_TEXPR(std::declval<R &&>().as_failure()), OUTCOME_TEXPR(std::declval<R &&>().assume_value()))
+inline detail::collect_rebind_t<R, void> collect_into(Range &&range, Container &out)
+{
+  detail::collect_reserve(out, detail::collect_size(range, 5), 5);
+  for(auto &&i : range)
+  {
+    using ref = detail::collect_reference<Range, decltype(i)>;
+    if(!i.has_value())
+    {
+      return static_cast<ref>(i).as_failure();
+    }
+    out.push_back(static_cast<ref>(i).assume_value());
+  }
+  return success();
+}
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+/* Collects the values of a range of `basic_result` or `basic_outcome` into a
+result of a `std::vector`, or returns the first failure. See `collect_into()`.
+*/
+OUTCOME_TEMPLATE(class Range, class R = detail::collect_element_type<Range>)
+OUTCOME_TREQUIRES(OUTCOME_TEXPR(std::declval<R &&>().as_failure()), OUTCOME_TEXPR(std::declval<R &&>().assume_value()))
+inline detail::collect_rebind_t<R, std::vector<typename R::value_type>> collect(Range &&range)
+{
+  std::vector<typename R::value_type> ret;
+  auto r = collect_into(static_cast<Range &&>(range), ret);
+  if(!r.has_value())
+  {
+    return static_cast<decltype(r) &&>(r).as_failure();
+  }
+  return static_cast<std::vector<typename R::value_type> &&>(ret);
+}
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+/* Appends the values of a range of `basic_result` or `basic_outcome` to
+`values`, and for every failure appends its index and `as_failure()` to
+`failures`, say a `std::vector<std::pair<size_t, failure_type<E>>>`. Returns
+the number of failures appended.
+*/
+OUTCOME_TEMPLATE(class Range, class Container, class Failures, class R = detail::collect_element_type<Range>)
+OUTCOME_TREQUIRES(OUTCOME_TEXPR(std::declval<R &&>().as_failure()), OUTCOME_TEXPR(std::declval<R &&>().assume_value()))
+inline size_t collect_all_into(Range &&range, Container &values, Failures &failures)
+{
+  detail::collect_reserve(values, detail::collect_size(range, 5), 5);
+  size_t index = 0, ret = 0;
+  for(auto &&i : range)
+  {
+    using ref = detail::collect_reference<Range, decltype(i)>;
+    if(i.has_value())
+    {
+      values.push_back(static_cast<ref>(i).assume_value());
+    }
+    else
+    {
+      failures.emplace_back(index, static_cast<ref>(i).as_failure());
+      ++ret;
+    }
+    ++index;
+  }
+  return ret;
+}
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <class T, class F> collected. Potential doc page: `collect_all()`
+*/
+template <class T, class F> struct OUTCOME_SYMBOL_VISIBLE collected
+{
+  //! The values of the successful results, in order.
+  std::vector<T> values;
+  //! The index and failure of each failed result, in order.
+  std::vector<std::pair<size_t, F>> failures;
+};
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+/* Collects all the values and all the failures of a range of `basic_result`
+or `basic_outcome`. See `collect_all_into()`.
+*/
+OUTCOME_TEMPLATE(class Range, class R = detail::collect_element_type<Range>)
+OUTCOME_TREQUIRES(OUTCOME_TEXPR(std::declval<R &&>().as_failure()), OUTCOME_TEXPR(std::declval<R &&>().assume_value()))
+inline collected<typename R::value_type, detail::collect_failure_type<Range>> collect_all(Range &&range)
+{
+  collected<typename R::value_type, detail::collect_failure_type<Range>> ret;
+  collect_all_into(static_cast<Range &&>(range), ret.values, ret.failures);
+  return ret;
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -25,90 +25,7 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef OUTCOME_V2_CONFIG_HPP
 #define OUTCOME_V2_CONFIG_HPP
 
-#include "detail/version.hpp"
-
-// Pull in detection of __MINGW64_VERSION_MAJOR
-#if defined(__MINGW32__) && !defined(DOXYGEN_IS_IN_THE_HOUSE)
-#include <_mingw.h>
-#endif
-
-#include "quickcpplib/config.hpp"
-
-#ifndef __cpp_variadic_templates
-#error Outcome needs variadic template support in the compiler
-#endif
-#if __cpp_constexpr < 201304 && _MSC_FULL_VER < 191100000
-#error Outcome needs constexpr (C++ 14) support in the compiler
-#endif
-#ifndef __cpp_variable_templates
-#error Outcome needs variable template support in the compiler
-#endif
-#if !defined(__clang__) && defined(__GNUC__) && __GNUC__ < 6
-#error Due to a bug in nested template variables parsing, Outcome does not work on GCCs earlier than v6.
-#endif
-
-#ifdef DOXYGEN_IS_IN_THE_HOUSE
-#define OUTCOME_FORCEINLINE
-#define OUTCOME_NODISCARD [[nodiscard]]
-#define OUTCOME_TEMPLATE(...) template <__VA_ARGS__
-#define OUTCOME_TREQUIRES(...) , __VA_ARGS__ >
-#define OUTCOME_TEXPR(...) typename = decltype(__VA_ARGS__)
-#define OUTCOME_TPRED(...) typename = std::enable_if_t<__VA_ARGS__>
-#define OUTCOME_REQUIRES(...) requires __VA_ARGS__
-/*! AWAITING HUGO JSON CONVERSION TOOL 
-SIGNATURE NOT RECOGNISED
-*/
-#endif
-
-#ifndef OUTCOME_SYMBOL_VISIBLE
-#define OUTCOME_SYMBOL_VISIBLE QUICKCPPLIB_SYMBOL_VISIBLE
-#endif
-#ifndef OUTCOME_FORCEINLINE
-#define OUTCOME_FORCEINLINE QUICKCPPLIB_FORCEINLINE
-#endif
-#ifndef OUTCOME_NODISCARD
-#define OUTCOME_NODISCARD QUICKCPPLIB_NODISCARD
-#endif
-#ifndef OUTCOME_THREAD_LOCAL
-#define OUTCOME_THREAD_LOCAL QUICKCPPLIB_THREAD_LOCAL
-#endif
-#ifndef OUTCOME_TEMPLATE
-#define OUTCOME_TEMPLATE(...) QUICKCPPLIB_TEMPLATE(__VA_ARGS__)
-#endif
-#ifndef OUTCOME_TREQUIRES
-#define OUTCOME_TREQUIRES(...) QUICKCPPLIB_TREQUIRES(__VA_ARGS__)
-#endif
-#ifndef OUTCOME_TEXPR
-#define OUTCOME_TEXPR(...) QUICKCPPLIB_TEXPR(__VA_ARGS__)
-#endif
-#ifndef OUTCOME_TPRED
-#define OUTCOME_TPRED(...) QUICKCPPLIB_TPRED(__VA_ARGS__)
-#endif
-#ifndef OUTCOME_REQUIRES
-#define OUTCOME_REQUIRES(...) QUICKCPPLIB_REQUIRES(__VA_ARGS__)
-#endif
-
-#include "quickcpplib/import.h"
-
-
-#if defined(OUTCOME_UNSTABLE_VERSION)
-#include "detail/revision.hpp"
-#define OUTCOME_V2 (QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2, OUTCOME_PREVIOUS_COMMIT_UNIQUE))
-#else
-#define OUTCOME_V2 (QUICKCPPLIB_BIND_NAMESPACE_VERSION(outcome_v2))
-#endif
-
-#if defined(GENERATING_OUTCOME_MODULE_INTERFACE)
-#define OUTCOME_V2_NAMESPACE QUICKCPPLIB_BIND_NAMESPACE(OUTCOME_V2)
-#define OUTCOME_V2_NAMESPACE_BEGIN QUICKCPPLIB_BIND_NAMESPACE_BEGIN(OUTCOME_V2)
-#define OUTCOME_V2_NAMESPACE_EXPORT_BEGIN QUICKCPPLIB_BIND_NAMESPACE_EXPORT_BEGIN(OUTCOME_V2)
-#define OUTCOME_V2_NAMESPACE_END QUICKCPPLIB_BIND_NAMESPACE_END(OUTCOME_V2)
-#else
-#define OUTCOME_V2_NAMESPACE QUICKCPPLIB_BIND_NAMESPACE(OUTCOME_V2)
-#define OUTCOME_V2_NAMESPACE_BEGIN QUICKCPPLIB_BIND_NAMESPACE_BEGIN(OUTCOME_V2)
-#define OUTCOME_V2_NAMESPACE_EXPORT_BEGIN QUICKCPPLIB_BIND_NAMESPACE_BEGIN(OUTCOME_V2)
-#define OUTCOME_V2_NAMESPACE_END QUICKCPPLIB_BIND_NAMESPACE_END(OUTCOME_V2)
-#endif
+#include "detail/config_macros.hpp"
 
 #include <cstdint>  // for uint32_t etc
 #include <initializer_list>
@@ -138,12 +55,12 @@ SIGNATURE NOT RECOGNISED
 #if OUTCOME_USE_STD_IN_PLACE_TYPE
 #include <utility>  // for in_place_type_t
 
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 template <class T> using in_place_type_t = std::in_place_type_t<T>;
 using std::in_place_type;
 OUTCOME_V2_NAMESPACE_END
 #else
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 /*! AWAITING HUGO JSON CONVERSION TOOL 
 type definition template <class T> in_place_type_t. Potential doc page: `in_place_type_t<T>`
 */
@@ -167,7 +84,34 @@ OUTCOME_V2_NAMESPACE_END
 #endif
 #endif
 
-OUTCOME_V2_NAMESPACE_BEGIN
+#ifndef OUTCOME_INLINE_VARIABLE
+#if __cpp_inline_variables >= 201606L
+//! Defined to be `inline` when the compiler has inline variables, so namespace scope constants have external linkage and can be exported from a module. Otherwise `static`.
+#define OUTCOME_INLINE_VARIABLE inline
+#else
+#define OUTCOME_INLINE_VARIABLE static
+#endif
+#endif
+
+#ifndef OUTCOME_HEADERS_ONLY
+//! Defined to be 0 by the `outcome::compiled` library, which compiles the cold paths and the common types out of line, so translation units need not. Otherwise 1.
+#define OUTCOME_HEADERS_ONLY 1
+#endif
+#if OUTCOME_HEADERS_ONLY || defined(GENERATING_OUTCOME_MODULE_INTERFACE)
+//! `inline` when header only, otherwise `extern`, as the function is defined in the compiled library.
+#define OUTCOME_HEADERS_ONLY_FUNC_SPEC inline
+#define OUTCOME_HEADERS_ONLY_DEFINITIONS 1
+#else
+#define OUTCOME_HEADERS_ONLY_FUNC_SPEC extern
+// Only the compiled library's own source sees the definitions
+#ifdef OUTCOME_SOURCE
+#define OUTCOME_HEADERS_ONLY_DEFINITIONS 1
+#else
+#define OUTCOME_HEADERS_ONLY_DEFINITIONS 0
+#endif
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 namespace detail
 {
   // Test if type is an in_place_type_t
@@ -217,36 +161,70 @@ namespace detail
   // static_assert(std::is_same_v<rebind_type<int, volatile const double &&>, volatile const int &&>, "");
 
 
+  /* The type traits asked of every value, error and exception type, and of every
+  constructor argument, use the compiler intrinsics where available. These cost a
+  fraction of instantiating the std type trait class, which typically instantiates
+  several more classes in turn.
+  */
+#if defined(__has_builtin)
+#if __has_builtin(__is_constructible) && !defined(OUTCOME_IS_CONSTRUCTIBLE)
+#define OUTCOME_IS_CONSTRUCTIBLE(...) __is_constructible(__VA_ARGS__)
+#endif
+#if __has_builtin(__is_convertible) && !defined(OUTCOME_IS_CONVERTIBLE)
+#define OUTCOME_IS_CONVERTIBLE(from, to) __is_convertible(from, to)
+#elif __has_builtin(__is_convertible_to) && !defined(OUTCOME_IS_CONVERTIBLE)
+#define OUTCOME_IS_CONVERTIBLE(from, to) __is_convertible_to(from, to)
+#endif
+#if __has_builtin(__is_assignable) && !defined(OUTCOME_IS_ASSIGNABLE)
+#define OUTCOME_IS_ASSIGNABLE(to, from) __is_assignable(to, from)
+#endif
+#if __has_builtin(__is_trivially_assignable) && !defined(OUTCOME_IS_TRIVIALLY_ASSIGNABLE)
+#define OUTCOME_IS_TRIVIALLY_ASSIGNABLE(to, from) __is_trivially_assignable(to, from)
+#endif
+#if __has_builtin(__is_trivially_copyable) && !defined(OUTCOME_IS_TRIVIALLY_COPYABLE)
+#define OUTCOME_IS_TRIVIALLY_COPYABLE(...) __is_trivially_copyable(__VA_ARGS__)
+#endif
+#elif defined(_MSC_VER)
+#ifndef OUTCOME_IS_CONSTRUCTIBLE
+#define OUTCOME_IS_CONSTRUCTIBLE(...) __is_constructible(__VA_ARGS__)
+#endif
+#ifndef OUTCOME_IS_CONVERTIBLE
+#define OUTCOME_IS_CONVERTIBLE(from, to) __is_convertible_to(from, to)
+#endif
+#ifndef OUTCOME_IS_ASSIGNABLE
+#define OUTCOME_IS_ASSIGNABLE(to, from) __is_assignable(to, from)
+#endif
+#ifndef OUTCOME_IS_TRIVIALLY_ASSIGNABLE
+#define OUTCOME_IS_TRIVIALLY_ASSIGNABLE(to, from) __is_trivially_assignable(to, from)
+#endif
+#ifndef OUTCOME_IS_TRIVIALLY_COPYABLE
+#define OUTCOME_IS_TRIVIALLY_COPYABLE(...) __is_trivially_copyable(__VA_ARGS__)
+#endif
+#endif
+#ifndef OUTCOME_IS_CONSTRUCTIBLE
+#define OUTCOME_IS_CONSTRUCTIBLE(...) std::is_constructible<__VA_ARGS__>::value
+#endif
+#ifndef OUTCOME_IS_CONVERTIBLE
+#define OUTCOME_IS_CONVERTIBLE(from, to) std::is_convertible<from, to>::value
+#endif
+#ifndef OUTCOME_IS_ASSIGNABLE
+#define OUTCOME_IS_ASSIGNABLE(to, from) std::is_assignable<to, from>::value
+#endif
+#ifndef OUTCOME_IS_TRIVIALLY_ASSIGNABLE
+#define OUTCOME_IS_TRIVIALLY_ASSIGNABLE(to, from) std::is_trivially_assignable<to, from>::value
+#endif
+#ifndef OUTCOME_IS_TRIVIALLY_COPYABLE
+#define OUTCOME_IS_TRIVIALLY_COPYABLE(...) std::is_trivially_copyable<__VA_ARGS__>::value
+#endif
+
   /* True if type is the same or constructible. Works around a bug where clang + libstdc++
   pukes on std::is_constructible<filesystem::path, void> (this bug is fixed upstream).
   */
-  template <class T, class U> struct _is_explicitly_constructible
-  {
-    static constexpr bool value = std::is_constructible<T, U>::value;
-  };
-  template <class T> struct _is_explicitly_constructible<T, void>
-  {
-    static constexpr bool value = false;
-  };
-  template <> struct _is_explicitly_constructible<void, void>
-  {
-    static constexpr bool value = false;
-  };
-  template <class T, class U> static constexpr bool is_explicitly_constructible = _is_explicitly_constructible<T, U>::value;
+  template <class T, class U> OUTCOME_INLINE_VARIABLE constexpr bool is_explicitly_constructible = OUTCOME_IS_CONSTRUCTIBLE(T, U);
+  template <class T> OUTCOME_INLINE_VARIABLE constexpr bool is_explicitly_constructible<T, void> = false;
 
-  template <class T, class U> struct _is_implicitly_constructible
-  {
-    static constexpr bool value = std::is_convertible<U, T>::value;
-  };
-  template <class T> struct _is_implicitly_constructible<T, void>
-  {
-    static constexpr bool value = false;
-  };
-  template <> struct _is_implicitly_constructible<void, void>
-  {
-    static constexpr bool value = false;
-  };
-  template <class T, class U> static constexpr bool is_implicitly_constructible = _is_implicitly_constructible<T, U>::value;
+  template <class T, class U> OUTCOME_INLINE_VARIABLE constexpr bool is_implicitly_constructible = OUTCOME_IS_CONVERTIBLE(U, T);
+  template <class T> OUTCOME_INLINE_VARIABLE constexpr bool is_implicitly_constructible<T, void> = false;
 
 #ifndef OUTCOME_USE_STD_IS_NOTHROW_SWAPPABLE
 #if defined(_MSC_VER) && _HAS_CXX17
@@ -298,7 +276,7 @@ OUTCOME_V2_NAMESPACE_END
 #endif  // OUTCOME_DISABLE_EXECINFO
 #include <cstdio>
 #include <cstdlib>
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 namespace detail
 {
   QUICKCPPLIB_NORETURN inline void do_fatal_exit(const char *expr)
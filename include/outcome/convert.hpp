@@ -27,6 +27,10 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include "detail/basic_result_storage.hpp"
 
+#include <cstddef>
+#include <cstring>  // for memcpy
+#include <iterator>
+
 OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 namespace convert
@@ -83,18 +87,18 @@ namespace convert
     OUTCOME_TREQUIRES(OUTCOME_TEXPR(std::declval<U>().has_value()), OUTCOME_TEXPR(std::declval<U>().value()), OUTCOME_TEXPR(std::declval<U>().error()))
     inline U match_value_or_error(U &&);
 
-    template <class U> static constexpr bool ValueOrNone = !std::is_same<no_match, decltype(match_value_or_none(std::declval<OUTCOME_V2_NAMESPACE::detail::devoid<U>>()))>::value;
-    template <class U> static constexpr bool ValueOrError = !std::is_same<no_match, decltype(match_value_or_error(std::declval<OUTCOME_V2_NAMESPACE::detail::devoid<U>>()))>::value;
+    template <class U> OUTCOME_INLINE_VARIABLE constexpr bool ValueOrNone = !std::is_same<no_match, decltype(match_value_or_none(std::declval<OUTCOME_V2_NAMESPACE::detail::devoid<U>>()))>::value;
+    template <class U> OUTCOME_INLINE_VARIABLE constexpr bool ValueOrError = !std::is_same<no_match, decltype(match_value_or_error(std::declval<OUTCOME_V2_NAMESPACE::detail::devoid<U>>()))>::value;
   }  // namespace detail
   /* The `ValueOrNone` concept.
   \requires That `U::value_type` exists and that `std::declval<U>().has_value()` returns a `bool` and `std::declval<U>().value()` exists.
   */
-  template <class U> static constexpr bool ValueOrNone = detail::ValueOrNone<U>;
+  template <class U> OUTCOME_INLINE_VARIABLE constexpr bool ValueOrNone = detail::ValueOrNone<U>;
   /* The `ValueOrError` concept.
   \requires That `U::value_type` and `U::error_type` exist;
   that `std::declval<U>().has_value()` returns a `bool`, `std::declval<U>().value()` and  `std::declval<U>().error()` exists.
   */
-  template <class U> static constexpr bool ValueOrError = detail::ValueOrError<U>;
+  template <class U> OUTCOME_INLINE_VARIABLE constexpr bool ValueOrError = detail::ValueOrError<U>;
 #endif
 
   namespace detail
@@ -127,6 +131,86 @@ type definition  value_or_error. Potential doc page: NOT FOUND
                                     &&(std::is_void<typename std::decay_t<X>::error_type>::value || OUTCOME_V2_NAMESPACE::detail::is_explicitly_constructible<typename T::error_type, typename std::decay_t<X>::error_type>) ))
     constexpr T operator()(X &&v) { return v.has_value() ? detail::make_type<T, typename T::value_type>::value(static_cast<X &&>(v)) : detail::make_type<T, typename U::error_type>::error(static_cast<X &&>(v)); }
   };
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  is_layout_compatible. Potential doc page: NOT FOUND
+*/
+  /* True if the bytes of a `U` are a valid `T` of the same value, so arrays of
+  `U` convert to arrays of `T` by `memcpy()`. By default only a trivially
+  copyable `T` is, with itself. Specialise it for foreign types which are.
+  */
+  template <class T, class U> struct is_layout_compatible : std::integral_constant<bool, std::is_same<T, U>::value && OUTCOME_IS_TRIVIALLY_COPYABLE(T)>
+  {
+  };
+
+  namespace detail
+  {
+    template <class T, class U> inline T *value_or_error_n(const U *in, size_t count, T *out, std::true_type /*unused*/) noexcept
+    {
+      static_assert(sizeof(T) == sizeof(U), "layout compatible types must be the same size");
+      if(count > 0)
+      {
+        std::memcpy(static_cast<void *>(out), static_cast<const void *>(in), count * sizeof(T));
+      }
+      return out + count;
+    }
+    template <class T, class U> inline T *value_or_error_n(const U *in, size_t count, T *out, std::false_type /*unused*/)
+    {
+      size_t n = 0;
+#ifdef __cpp_exceptions
+      try
+      {
+#endif
+        for(; n < count; ++n)
+        {
+          new(out + n) T(value_or_error<T, U>{}(in[n]));  // NOLINT
+        }
+#ifdef __cpp_exceptions
+      }
+      catch(...)
+      {
+        while(n > 0)
+        {
+          out[--n].~T();
+        }
+        throw;
+      }
+#endif
+      return out + count;
+    }
+
+    template <class Container, class Range> inline auto value_or_error_reserve(Container &c, const Range &r, int /*unused*/) -> decltype(c.reserve(c.size() + r.size()), void()) { c.reserve(c.size() + r.size()); }
+    template <class Container, class Range> inline void value_or_error_reserve(Container & /*unused*/, const Range & /*unused*/, ... /*unused*/) {}
+  }  // namespace detail
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  /* Converts the `count` objects at `in` by `value_or_error<T, U>` straight into
+  the uninitialised storage at `out`, each result being constructed in place.
+  If `is_layout_compatible<T, U>`, it is one `memcpy()` instead. If any
+  conversion throws, those already constructed are destroyed. Returns the end
+  of the converted results.
+  */
+  template <class T, class U> inline T *value_or_error_n(const U *in, size_t count, T *out)
+  {
+    return detail::value_or_error_n(in, count, out, std::integral_constant<bool, is_layout_compatible<T, U>::value>());
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  /* Converts each object of `range` by `value_or_error<T, U>` and appends it to
+  `out`, a container of `T`, reserving first if the range knows its size.
+  */
+  template <class Range, class Container, class T = typename Container::value_type, class U = std::decay_t<decltype(*std::begin(std::declval<Range &>()))>> inline void value_or_error_into(Range &&range, Container &out)
+  {
+    detail::value_or_error_reserve(out, range, 5);
+    for(auto &&i : range)
+    {
+      out.push_back(value_or_error<T, U>{}(i));
+    }
+  }
 }  // namespace convert
 
 OUTCOME_V2_NAMESPACE_END
@@ -66,7 +66,7 @@ namespace detail
       }
       if(this->_state._status.have_error() && o._state._status.have_error())
       {
-        return this->_error == o._error;
+        return _error_equal(this->_state, this->_error, o._error);
       }
       return false;
     }
@@ -93,7 +93,7 @@ namespace detail
     {
       if(this->_state._status.have_error())
       {
-        return this->_error == o.error();
+        return _error_equal(this->_state, this->_error, o.error());
       }
       return false;
     }
@@ -109,7 +109,7 @@ namespace detail
       }
       if(this->_state._status.have_error() && o._state._status.have_error())
       {
-        return this->_error != o._error;
+        return _error_not_equal(this->_state, this->_error, o._error);
       }
       return true;
     }
@@ -136,7 +136,7 @@ namespace detail
     {
       if(this->_state._status.have_error())
       {
-        return this->_error != o.error();
+        return _error_not_equal(this->_state, this->_error, o.error());
       }
       return true;
     }
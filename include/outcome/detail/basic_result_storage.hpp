@@ -34,6 +34,9 @@ OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 namespace detail
 {
   template <class State, class E> constexpr inline void _set_error_is_errno(State & /*unused*/, const E & /*unused*/) {}
+  // Customised by error types with a faster equality than their operator==, found by ADL on State
+  template <class State, class A, class B> constexpr inline bool _error_equal(const State & /*unused*/, const A &a, const B &b) noexcept(noexcept(a == b)) { return a == b; }
+  template <class State, class A, class B> constexpr inline bool _error_not_equal(const State & /*unused*/, const A &a, const B &b) noexcept(noexcept(a != b)) { return a != b; }
   template <class R, class S, class NoValuePolicy> class basic_result_final;
 }  // namespace detail
 
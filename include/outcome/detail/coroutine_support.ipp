@@ -32,10 +32,10 @@ Distributed under the Boost Software License, Version 1.0.
 #include <atomic>
 #include <cassert>
 
-#if __cpp_coroutines
+#if __cpp_coroutines || __cpp_impl_coroutine
 #if __has_include(<coroutine>)
 #include <coroutine>
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 namespace awaitables
 {
   template <class Promise = void> using coroutine_handle = std::coroutine_handle<Promise>;
@@ -47,7 +47,7 @@ OUTCOME_V2_NAMESPACE_END
 #define OUTCOME_FOUND_COROUTINE_HEADER 1
 #elif __has_include(<experimental/coroutine>)
 #include <experimental/coroutine>
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 namespace awaitables
 {
   template <class Promise = void> using coroutine_handle = std::experimental::coroutine_handle<Promise>;
@@ -176,17 +176,17 @@ namespace awaitables
         {
           bool await_ready() noexcept { return !suspend_initial; }
           void await_resume() noexcept {}
-          void await_suspend(coroutine_handle<> /*unused*/) {}
+          void await_suspend(coroutine_handle<> /*unused*/) noexcept {}
         };
         return awaiter{};
       }
-      auto final_suspend()
+      auto final_suspend() noexcept
       {
         struct awaiter
         {
           bool await_ready() noexcept { return false; }
           void await_resume() noexcept {}
-          void await_suspend(coroutine_handle<outcome_promise_type> self)
+          void await_suspend(coroutine_handle<outcome_promise_type> self) noexcept
           {
             if(self.promise().continuation)
             {
@@ -227,17 +227,17 @@ namespace awaitables
         {
           bool await_ready() noexcept { return !suspend_initial; }
           void await_resume() noexcept {}
-          void await_suspend(coroutine_handle<> /*unused*/) {}
+          void await_suspend(coroutine_handle<> /*unused*/) noexcept {}
         };
         return awaiter{};
       }
-      auto final_suspend()
+      auto final_suspend() noexcept
       {
         struct awaiter
         {
           bool await_ready() noexcept { return false; }
           void await_resume() noexcept {}
-          void await_suspend(coroutine_handle<outcome_promise_type> self)
+          void await_suspend(coroutine_handle<outcome_promise_type> self) noexcept
           {
             if(self.promise().continuation)
             {
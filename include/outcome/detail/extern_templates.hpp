@@ -0,0 +1,102 @@
+/* Extern template declarations for the compiled library
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* When OUTCOME_HEADERS_ONLY is 0, that is when linking the outcome::compiled
+CMake target, result.hpp, outcome.hpp and iostream_support.hpp declare
+`result<T>` and `outcome<T>` and their bases as explicitly instantiated
+elsewhere for each `T` in OUTCOME_EXTERN_TEMPLATE_TYPES, and `print()` for them
+too, using the macros here, so each translation unit does not instantiate and
+emit its own copy. src/outcome.cpp has the explicit instantiations.
+*/
+
+#ifndef OUTCOME_DETAIL_EXTERN_TEMPLATES_HPP
+#define OUTCOME_DETAIL_EXTERN_TEMPLATES_HPP
+
+#include "../basic_result.hpp"
+
+#include <string>
+
+#if !OUTCOME_HEADERS_ONLY && !defined(GENERATING_OUTCOME_MODULE_INTERFACE)
+#define OUTCOME_USE_EXTERN_TEMPLATES 1
+#else
+#define OUTCOME_USE_EXTERN_TEMPLATES 0
+#endif
+
+/* To change the list of types, name a header defining OUTCOME_EXTERN_TEMPLATE_TYPES
+in OUTCOME_EXTERN_TEMPLATE_TYPES_FILE (the CMake cache variable
+OUTCOME_COMPILED_TYPES_FILE does this for both the library and its users).
+Each type must be a single token sequence without commas, so use a typedef for
+anything with template arguments, and each type must be printable with
+`operator<<`. Different spellings of the same type, such as `long` and
+`int64_t` on some platforms, must not both be listed.
+*/
+#ifdef OUTCOME_EXTERN_TEMPLATE_TYPES_FILE
+#include OUTCOME_EXTERN_TEMPLATE_TYPES_FILE
+#endif
+#ifndef OUTCOME_EXTERN_TEMPLATE_TYPES
+#define OUTCOME_EXTERN_TEMPLATE_TYPES(XX) XX(void) XX(bool) XX(int) XX(unsigned) XX(long long) XX(unsigned long long) XX(double) XX(std::string)
+#endif
+
+OUTCOME_V2_NAMESPACE_BEGIN
+namespace detail
+{
+  template <class R, class EP> using extern_template_policy = policy::default_policy<R, std::error_code, EP>;
+  template <class R, class EP> using extern_template_storage = basic_result_storage<R, std::error_code, extern_template_policy<R, EP>>;
+  template <class R, class EP> using extern_template_value_observers = basic_result_value_observers<extern_template_storage<R, EP>, R, extern_template_policy<R, EP>>;
+  template <class R, class EP> using extern_template_final = basic_result_final<R, std::error_code, extern_template_policy<R, EP>>;
+}  // namespace detail
+OUTCOME_V2_NAMESPACE_END
+
+#define OUTCOME_EXPLICIT_INSTANTIATE_RESULT_FINAL(prefix, R, EP)                                                                                               \
+  prefix class detail::basic_result_storage<R, std::error_code, detail::extern_template_policy<R, EP>>;                                                       \
+  prefix class detail::basic_result_value_observers<detail::extern_template_storage<R, EP>, R, detail::extern_template_policy<R, EP>>;                         \
+  prefix class detail::basic_result_error_observers<detail::extern_template_value_observers<R, EP>, std::error_code, detail::extern_template_policy<R, EP>>; \
+  prefix class detail::basic_result_final<R, std::error_code, detail::extern_template_policy<R, EP>>;
+
+//! Explicitly instantiates, or with `extern template` declares, `result<R>` and its bases
+#define OUTCOME_EXPLICIT_INSTANTIATE_RESULT(prefix, R)       \
+  OUTCOME_EXPLICIT_INSTANTIATE_RESULT_FINAL(prefix, R, void) \
+  prefix class basic_result<R, std::error_code, detail::extern_template_policy<R, void>>;
+
+//! Explicitly instantiates, or with `extern template` declares, `outcome<R>` and its bases
+#define OUTCOME_EXPLICIT_INSTANTIATE_OUTCOME(prefix, R)                                                                                                       \
+  OUTCOME_EXPLICIT_INSTANTIATE_RESULT_FINAL(prefix, R, std::exception_ptr)                                                                                    \
+  prefix class detail::basic_outcome_exception_observers<detail::extern_template_final<R, std::exception_ptr>, R, std::error_code, std::exception_ptr,      \
+                                                         detail::extern_template_policy<R, std::exception_ptr>>;                                              \
+  prefix class detail::basic_outcome_failure_observers<                                                                                                       \
+  detail::basic_outcome_exception_observers<detail::extern_template_final<R, std::exception_ptr>, R, std::error_code, std::exception_ptr,                      \
+                                            detail::extern_template_policy<R, std::exception_ptr>>,                                                           \
+  R, std::error_code, std::exception_ptr, detail::extern_template_policy<R, std::exception_ptr>>;                                                             \
+  prefix class basic_outcome<R, std::error_code, std::exception_ptr, detail::extern_template_policy<R, std::exception_ptr>>;
+
+//! Explicitly instantiates, or with `extern template` declares, `print()` for `result<R>` and `outcome<R>`
+#define OUTCOME_EXPLICIT_INSTANTIATE_PRINT(prefix, R) \
+  prefix std::string print(const result<R> &);       \
+  prefix std::string print(const outcome<R> &);
+
+#define OUTCOME_EXTERN_TEMPLATE_RESULT(R) OUTCOME_EXPLICIT_INSTANTIATE_RESULT(extern template, R)
+#define OUTCOME_EXTERN_TEMPLATE_OUTCOME(R) OUTCOME_EXPLICIT_INSTANTIATE_OUTCOME(extern template, R)
+#define OUTCOME_EXTERN_TEMPLATE_PRINT(R) OUTCOME_EXPLICIT_INSTANTIATE_PRINT(extern template, R)
+
+#endif
@@ -0,0 +1,83 @@
+/* What the Outcome modules include from outside Outcome
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Included by the global module fragment of the outcome and
+outcome.experimental modules, so everything Outcome includes from outside
+itself is not attached to those modules.
+
+Some compilers, including GCC before 14, get confused when a header which went
+into the global module fragment of a module is #included after importing that
+module, so include this before importing to keep them happy.
+*/
+#ifndef OUTCOME_DETAIL_GLOBAL_MODULE_FRAGMENT_HPP
+#define OUTCOME_DETAIL_GLOBAL_MODULE_FRAGMENT_HPP
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <iosfwd>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#if __has_include(<coroutine>)
+#include <coroutine>
+#endif
+#if __has_include(<expected>)
+#include <expected>
+#endif
+#if __has_include(<ranges>)
+#include <ranges>
+#endif
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+#if !defined(OUTCOME_DISABLE_EXECINFO) && !defined(_WIN32)
+#include <execinfo.h>
+#endif
+
+#include "quickcpplib/config.hpp"
+#include "quickcpplib/import.h"
+
+#endif
@@ -0,0 +1,158 @@
+/* A lock free cache of interned error messages
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_DETAIL_MESSAGE_CACHE_HPP
+#define OUTCOME_DETAIL_MESSAGE_CACHE_HPP
+
+#include "../config.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#ifndef OUTCOME_MESSAGE_CACHE_MAX_ENTRIES
+//! The most messages interned for `std::error_code`, and separately for status codes
+#define OUTCOME_MESSAGE_CACHE_MAX_ENTRIES 4096
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition cached_message_type. Potential doc page: NOT FOUND
+*/
+/* What `cached_message()` returns. Usually this refers to the interned
+message, which lives for the rest of the program. Once the cache is full,
+this instead holds a message made for this call alone, which lives only as
+long as this object.
+*/
+class cached_message_type
+{
+  const std::string *_interned{nullptr};
+  std::string _uncached;
+
+public:
+  //! Refers to an interned message
+  explicit cached_message_type(const std::string *interned) noexcept
+      : _interned(interned)
+  {
+  }
+  //! Holds a message which was not interned
+  explicit cached_message_type(std::string uncached) noexcept
+      : _uncached(static_cast<std::string &&>(uncached))
+  {
+  }
+
+  //! True if the message is interned, and so lives for the rest of the program
+  bool is_interned() const noexcept { return _interned != nullptr; }
+  //! The message
+  const std::string &str() const noexcept { return (_interned != nullptr) ? *_interned : _uncached; }
+  operator const std::string &() const &noexcept { return str(); }  // NOLINT
+  //! Implicitly referring into a temporary would dangle, use `str()` instead
+  operator const std::string &() const && = delete;  // NOLINT
+};
+
+namespace detail
+{
+  /* A fixed size hash table of messages keyed by (domain, value), where the
+  domain is the address of a `std::error_category` or the id of a status code
+  domain, depending on `Tag`. Each bucket is a lock free list to which nodes
+  are only ever prepended, never removed, so a found message lives until the
+  program exits and lookups need only acquire loads. Codes with arbitrary
+  values could otherwise grow this without limit, so at most
+  `OUTCOME_MESSAGE_CACHE_MAX_ENTRIES` messages are interned, after which
+  messages not already interned are made anew by each caller.
+  */
+  template <class Tag> class message_cache
+  {
+    static constexpr size_t _buckets = 1024;
+    static constexpr size_t _max_entries = OUTCOME_MESSAGE_CACHE_MAX_ENTRIES;
+
+    struct _node
+    {
+      uint64_t domain;
+      intptr_t value;
+      std::string message;
+      _node *next;
+    };
+
+    static std::atomic<_node *> &_bucket(uint64_t domain, intptr_t value) noexcept
+    {
+      static std::atomic<_node *> table[_buckets];
+      uint64_t h = domain * 0x9e3779b97f4a7c15ULL;
+      h ^= static_cast<uint64_t>(value) * 0xff51afd7ed558ccdULL;
+      return table[static_cast<size_t>(h ^ (h >> 32U)) % _buckets];
+    }
+    static std::atomic<size_t> &_entries() noexcept
+    {
+      static std::atomic<size_t> v{0};
+      return v;
+    }
+    static const _node *_find(const _node *n, const _node *end, uint64_t domain, intptr_t value) noexcept
+    {
+      for(; n != end; n = n->next)
+      {
+        if(n->domain == domain && n->value == value)
+        {
+          return n;
+        }
+      }
+      return nullptr;
+    }
+
+  public:
+    template <class F> static cached_message_type get(uint64_t domain, intptr_t value, F &&make)
+    {
+      std::atomic<_node *> &bucket = _bucket(domain, value);
+      _node *head = bucket.load(std::memory_order_acquire);
+      if(const _node *found = _find(head, nullptr, domain, value))
+      {
+        return cached_message_type(&found->message);
+      }
+      // Reserve an entry before making one, so racing threads cannot overshoot the limit
+      std::atomic<size_t> &entries = _entries();
+      if(entries.fetch_add(1, std::memory_order_relaxed) >= _max_entries)
+      {
+        entries.fetch_sub(1, std::memory_order_relaxed);
+        return cached_message_type(make());
+      }
+      auto *mine = new _node{domain, value, make(), head};
+      while(!bucket.compare_exchange_weak(mine->next, mine, std::memory_order_acq_rel, std::memory_order_acquire))
+      {
+        // Someone else prepended, so check whether they added ours
+        if(const _node *found = _find(mine->next, head, domain, value))
+        {
+          delete mine;
+          entries.fetch_sub(1, std::memory_order_relaxed);
+          return cached_message_type(&found->message);
+        }
+        head = mine->next;
+      }
+      return cached_message_type(&mine->message);
+    }
+  };
+}  // namespace detail
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
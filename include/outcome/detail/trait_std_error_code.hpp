@@ -26,32 +26,25 @@ Distributed under the Boost Software License, Version 1.0.
 #define OUTCOME_TRAIT_STD_ERROR_CODE_HPP
 
 #include "../config.hpp"
+#include "../errno_tables.hpp"
 
 #include <system_error>
 
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 namespace detail
 {
   // Customise _set_error_is_errno
   template <class State> constexpr inline void _set_error_is_errno(State &state, const std::error_code &error)
   {
-    if(error.category() == std::generic_category()
-#ifndef _WIN32
-       || error.category() == std::system_category()
-#endif
-    )
+    if(is_errno_category(error.category()))
     {
       state._status.set_have_error_is_errno(true);
     }
   }
   template <class State> constexpr inline void _set_error_is_errno(State &state, const std::error_condition &error)
   {
-    if(error.category() == std::generic_category()
-#ifndef _WIN32
-       || error.category() == std::system_category()
-#endif
-    )
+    if(is_errno_category(error.category()))
     {
       state._status.set_have_error_is_errno(true);
     }
@@ -59,6 +52,22 @@ namespace detail
   template <class State> constexpr inline void _set_error_is_errno(State &state, const std::errc & /*unused*/) {
       state._status.set_have_error_is_errno(true);
    }
+  // Customise _error_equal. Generic codes equal an errc exactly when their values are
+  // equal, so the category's virtual equivalent() is not needed. Any other category
+  // costs just the one identity test more than comparing normally.
+  template <class State> inline bool _error_equal(const State & /*unused*/, const std::error_code &a, const std::errc &b) noexcept
+  {
+    return (a.category() == std::generic_category()) ? (a.value() == static_cast<int>(b)) : (a == b);
+  }
+  template <class State> inline bool _error_not_equal(const State &state, const std::error_code &a, const std::errc &b) noexcept { return !_error_equal(state, a, b); }
+  // Values differ far more often than categories, so test them first. Categories
+  // are compared with their operator== as some standard libraries give categories
+  // identities which survive being duplicated across shared libraries.
+  template <class State> inline bool _error_equal(const State & /*unused*/, const std::error_code &a, const std::error_code &b) noexcept
+  {
+    return a.value() == b.value() && a.category() == b.category();
+  }
+  template <class State> inline bool _error_not_equal(const State &state, const std::error_code &a, const std::error_code &b) noexcept { return !_error_equal(state, a, b); }
 
 }  // namespace detail
 
@@ -87,7 +96,11 @@ SIGNATURE NOT RECOGNISED
 SIGNATURE NOT RECOGNISED
 */
   // inline void outcome_throw_as_system_error_with_payload(...) = delete;  // To use the error_code_throw_as_system_error policy with a custom Error type, you must define a outcome_throw_as_system_error_with_payload() free function to say how to handle the payload
-  inline void outcome_throw_as_system_error_with_payload(const std::error_code &error) { OUTCOME_THROW_EXCEPTION(std::system_error(error)); }  // NOLINT
+#if OUTCOME_HEADERS_ONLY_DEFINITIONS
+  OUTCOME_HEADERS_ONLY_FUNC_SPEC void outcome_throw_as_system_error_with_payload(const std::error_code &error) { OUTCOME_THROW_EXCEPTION(std::system_error(error)); }  // NOLINT
+#else
+  OUTCOME_HEADERS_ONLY_FUNC_SPEC void outcome_throw_as_system_error_with_payload(const std::error_code &error);
+#endif
   OUTCOME_TEMPLATE(class Error)
   OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_error_code_enum<std::decay_t<Error>>::value || std::is_error_condition_enum<std::decay_t<Error>>::value))
   inline void outcome_throw_as_system_error_with_payload(Error &&error, detail::std_enum_overload_tag /*unused*/ = detail::std_enum_overload_tag()) { OUTCOME_THROW_EXCEPTION(std::system_error(make_error_code(error))); }  // NOLINT
@@ -29,7 +29,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <exception>
 
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 namespace policy
 {
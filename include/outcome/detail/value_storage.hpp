@@ -29,7 +29,7 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include <cassert>
 
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 namespace detail
 {
@@ -1034,27 +1034,28 @@ namespace detail
     }
   };
 
-  // We don't actually need all of std::is_trivial<>, std::is_trivially_copyable<> is sufficient
-  template <class T>
-  using value_storage_select_trivality =
-  std::conditional_t<std::is_trivially_copyable<devoid<T>>::value, value_storage_trivial<T>, value_storage_nontrivial<T>>;
-  template <class T>
-  using value_storage_select_move_constructor = std::conditional_t<std::is_move_constructible<devoid<T>>::value, value_storage_select_trivality<T>,
-                                                                   value_storage_delete_move_constructor<value_storage_select_trivality<T>>>;
-  template <class T>
-  using value_storage_select_copy_constructor = std::conditional_t<std::is_copy_constructible<devoid<T>>::value, value_storage_select_move_constructor<T>,
-                                                                   value_storage_delete_copy_constructor<value_storage_select_move_constructor<T>>>;
-  template <class T>
-  using value_storage_select_move_assignment = std::conditional_t<
-  std::is_trivially_move_assignable<devoid<T>>::value, value_storage_select_copy_constructor<T>,
-  std::conditional_t<std::is_move_assignable<devoid<T>>::value, value_storage_nontrivial_move_assignment<value_storage_select_copy_constructor<T>>,
-                     value_storage_delete_copy_assignment<value_storage_select_copy_constructor<T>>>>;
-  template <class T>
-  using value_storage_select_copy_assignment = std::conditional_t<
-  std::is_trivially_copy_assignable<devoid<T>>::value, value_storage_select_move_assignment<T>,
-  std::conditional_t<std::is_copy_assignable<devoid<T>>::value, value_storage_nontrivial_copy_assignment<value_storage_select_move_assignment<T>>,
-                     value_storage_delete_copy_assignment<value_storage_select_move_assignment<T>>>>;
-  template <class T> using value_storage_select_impl = value_storage_select_copy_assignment<T>;
+  /* Selects the storage for T, layering on whichever special member functions need
+  deleting or implementing. Each layer is a member of one class so it is computed once
+  per T, rather than nested aliases which the compiler must reexpand at every level.
+  */
+  template <class T> struct value_storage_select
+  {
+    using _t = devoid<T>;
+    // We don't actually need all of std::is_trivial<>, std::is_trivially_copyable<> is sufficient
+    using trivality = std::conditional_t<OUTCOME_IS_TRIVIALLY_COPYABLE(_t), value_storage_trivial<T>, value_storage_nontrivial<T>>;
+    using move_constructor = std::conditional_t<OUTCOME_IS_CONSTRUCTIBLE(_t, _t &&), trivality, value_storage_delete_move_constructor<trivality>>;
+    using copy_constructor =
+    std::conditional_t<OUTCOME_IS_CONSTRUCTIBLE(_t, const _t &), move_constructor, value_storage_delete_copy_constructor<move_constructor>>;
+    using move_assignment =
+    std::conditional_t<OUTCOME_IS_TRIVIALLY_ASSIGNABLE(_t &, _t &&), copy_constructor,
+                       std::conditional_t<OUTCOME_IS_ASSIGNABLE(_t &, _t &&), value_storage_nontrivial_move_assignment<copy_constructor>,
+                                          value_storage_delete_copy_assignment<copy_constructor>>>;
+    using copy_assignment =
+    std::conditional_t<OUTCOME_IS_TRIVIALLY_ASSIGNABLE(_t &, const _t &), move_assignment,
+                       std::conditional_t<OUTCOME_IS_ASSIGNABLE(_t &, const _t &), value_storage_nontrivial_copy_assignment<move_assignment>,
+                                          value_storage_delete_copy_assignment<move_assignment>>>;
+  };
+  template <class T> using value_storage_select_impl = typename value_storage_select<T>::copy_assignment;
 #ifndef NDEBUG
   // Check is trivial in all ways except default constructibility
   // static_assert(std::is_trivial<value_storage_select_impl<int>>::value, "value_storage_select_impl<int> is not trivial!");
@@ -0,0 +1,206 @@
+/* Compile time tables classifying errno values
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_ERRNO_TABLES_HPP
+#define OUTCOME_ERRNO_TABLES_HPP
+
+#include "config.hpp"
+
+#include <cerrno>
+#include <system_error>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition errno_exception. Potential doc page: NOT FOUND
+*/
+/* The standard exception `try_throw_std_exception_from_error()` throws for an
+errno value, if any.
+*/
+enum class errno_exception : unsigned char
+{
+  none,
+  invalid_argument,
+  domain_error,
+  length_error,
+  out_of_range,
+  overflow_error,
+  bad_alloc
+};
+
+namespace detail
+{
+  /* Tables indexed by errno value, generated at compile time. Values outside
+  the tables classify as index zero, which is not an errno, so each lookup
+  is a compare, a conditional move and a load.
+  */
+  struct errno_table
+  {
+    static constexpr unsigned size = 256;
+
+    bool is_errc[size];
+    errno_exception exception[size];
+
+    constexpr errno_table() noexcept
+        : is_errc{}
+        , exception{}
+    {
+      const int errcs[] = {
+        static_cast<int>(std::errc::address_family_not_supported),
+        static_cast<int>(std::errc::address_in_use),
+        static_cast<int>(std::errc::address_not_available),
+        static_cast<int>(std::errc::already_connected),
+        static_cast<int>(std::errc::argument_list_too_long),
+        static_cast<int>(std::errc::argument_out_of_domain),
+        static_cast<int>(std::errc::bad_address),
+        static_cast<int>(std::errc::bad_file_descriptor),
+        static_cast<int>(std::errc::bad_message),
+        static_cast<int>(std::errc::broken_pipe),
+        static_cast<int>(std::errc::connection_aborted),
+        static_cast<int>(std::errc::connection_already_in_progress),
+        static_cast<int>(std::errc::connection_refused),
+        static_cast<int>(std::errc::connection_reset),
+        static_cast<int>(std::errc::cross_device_link),
+        static_cast<int>(std::errc::destination_address_required),
+        static_cast<int>(std::errc::device_or_resource_busy),
+        static_cast<int>(std::errc::directory_not_empty),
+        static_cast<int>(std::errc::executable_format_error),
+        static_cast<int>(std::errc::file_exists),
+        static_cast<int>(std::errc::file_too_large),
+        static_cast<int>(std::errc::filename_too_long),
+        static_cast<int>(std::errc::function_not_supported),
+        static_cast<int>(std::errc::host_unreachable),
+        static_cast<int>(std::errc::identifier_removed),
+        static_cast<int>(std::errc::illegal_byte_sequence),
+        static_cast<int>(std::errc::inappropriate_io_control_operation),
+        static_cast<int>(std::errc::interrupted),
+        static_cast<int>(std::errc::invalid_argument),
+        static_cast<int>(std::errc::invalid_seek),
+        static_cast<int>(std::errc::io_error),
+        static_cast<int>(std::errc::is_a_directory),
+        static_cast<int>(std::errc::message_size),
+        static_cast<int>(std::errc::network_down),
+        static_cast<int>(std::errc::network_reset),
+        static_cast<int>(std::errc::network_unreachable),
+        static_cast<int>(std::errc::no_buffer_space),
+        static_cast<int>(std::errc::no_child_process),
+        static_cast<int>(std::errc::no_link),
+        static_cast<int>(std::errc::no_lock_available),
+        static_cast<int>(std::errc::no_message_available),
+        static_cast<int>(std::errc::no_message),
+        static_cast<int>(std::errc::no_protocol_option),
+        static_cast<int>(std::errc::no_space_on_device),
+        static_cast<int>(std::errc::no_stream_resources),
+        static_cast<int>(std::errc::no_such_device_or_address),
+        static_cast<int>(std::errc::no_such_device),
+        static_cast<int>(std::errc::no_such_file_or_directory),
+        static_cast<int>(std::errc::no_such_process),
+        static_cast<int>(std::errc::not_a_directory),
+        static_cast<int>(std::errc::not_a_socket),
+        static_cast<int>(std::errc::not_a_stream),
+        static_cast<int>(std::errc::not_connected),
+        static_cast<int>(std::errc::not_enough_memory),
+        static_cast<int>(std::errc::not_supported),
+        static_cast<int>(std::errc::operation_canceled),
+        static_cast<int>(std::errc::operation_in_progress),
+        static_cast<int>(std::errc::operation_not_permitted),
+        static_cast<int>(std::errc::operation_not_supported),
+        static_cast<int>(std::errc::operation_would_block),
+        static_cast<int>(std::errc::owner_dead),
+        static_cast<int>(std::errc::permission_denied),
+        static_cast<int>(std::errc::protocol_error),
+        static_cast<int>(std::errc::protocol_not_supported),
+        static_cast<int>(std::errc::read_only_file_system),
+        static_cast<int>(std::errc::resource_deadlock_would_occur),
+        static_cast<int>(std::errc::resource_unavailable_try_again),
+        static_cast<int>(std::errc::result_out_of_range),
+        static_cast<int>(std::errc::state_not_recoverable),
+        static_cast<int>(std::errc::stream_timeout),
+        static_cast<int>(std::errc::text_file_busy),
+        static_cast<int>(std::errc::timed_out),
+        static_cast<int>(std::errc::too_many_files_open_in_system),
+        static_cast<int>(std::errc::too_many_files_open),
+        static_cast<int>(std::errc::too_many_links),
+        static_cast<int>(std::errc::too_many_symbolic_link_levels),
+        static_cast<int>(std::errc::value_too_large),
+        static_cast<int>(std::errc::wrong_protocol_type),
+      };
+      for(int v : errcs)
+      {
+        if(v > 0 && static_cast<unsigned>(v) < size)
+        {
+          is_errc[v] = true;
+        }
+      }
+      exception[EINVAL] = errno_exception::invalid_argument;
+      exception[EDOM] = errno_exception::domain_error;
+      exception[E2BIG] = errno_exception::length_error;
+      exception[ERANGE] = errno_exception::out_of_range;
+      exception[EOVERFLOW] = errno_exception::overflow_error;
+      exception[ENOMEM] = errno_exception::bad_alloc;
+    }
+    static constexpr unsigned index(int v) noexcept { return (static_cast<unsigned>(v) < size) ? static_cast<unsigned>(v) : 0U; }
+  };
+  OUTCOME_INLINE_VARIABLE constexpr errno_table errno_table_v{};
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+/* True if `v` is the value of some `std::errc`, and so also of a
+`generic_code`, without branching.
+*/
+constexpr inline bool errno_is_errc(int v) noexcept
+{
+  return detail::errno_table_v.is_errc[detail::errno_table::index(v)];
+}
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+/* The standard exception matching errno value `v`, without branching.
+*/
+constexpr inline errno_exception errno_exception_kind(int v) noexcept
+{
+  return detail::errno_table_v.exception[detail::errno_table::index(v)];
+}
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+/* True if codes of category `c` have errno values, that is it is the generic
+category, or the system category on POSIX.
+*/
+inline bool is_errno_category(const std::error_category &c) noexcept
+{
+#ifndef _WIN32
+  return c == std::generic_category() || c == std::system_category();
+#else
+  return c == std::generic_category();
+#endif
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,329 @@
+/* A lock free channel collecting errors from many threads
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_ERROR_CHANNEL_HPP
+#define OUTCOME_ERROR_CHANNEL_HPP
+
+#include "basic_result.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  // Errors are coalesced if they are a category and an int value, like std::error_code
+  template <class E, class = void> struct error_channel_coalescing
+  {
+    static constexpr bool value = false;
+  };
+  template <class E>
+  struct error_channel_coalescing<E, std::enable_if_t<std::is_same<decltype(std::declval<const E &>().value()), int>::value &&
+                                                      std::is_constructible<E, int, decltype(std::declval<const E &>().category())>::value>>
+  {
+    static constexpr bool value = true;
+    using category_type = std::decay_t<decltype(std::declval<const E &>().category())>;
+  };
+
+  inline size_t error_channel_round_up(size_t v) noexcept
+  {
+    size_t ret = 2;
+    while(ret < v)
+    {
+      ret <<= 1U;
+    }
+    return ret;
+  }
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <class E> basic_error_channel. Potential doc page: `basic_error_channel<E>`
+*/
+/* Collects errors of type `E` pushed by any number of threads, to be drained
+in batches by one consumer thread, say for retry or alerting. Nothing blocks,
+nothing allocates after construction, and when full, pushes are counted
+rather than stored.
+
+If `E` is a category and an int value, like `std::error_code`, identical
+errors are coalesced into one entry with a count, so a storm of the same
+failure occupies one slot in a small table rather than filling the ring.
+Errors which cannot be coalesced, because their table slot holds a different
+error, go into the ring.
+*/
+template <class E> class OUTCOME_SYMBOL_VISIBLE basic_error_channel
+{
+  static constexpr bool _coalescing = detail::error_channel_coalescing<E>::value;
+  static constexpr size_t _cache_line = 64;
+  // A ring cell is claimed before its error is moved in, so that move cannot be allowed to fail
+  static_assert(std::is_nothrow_move_constructible<E>::value, "basic_error_channel<E> requires E to be nothrow move constructible");
+
+  struct _cell
+  {
+    std::atomic<size_t> seq;
+    union {
+      detail::empty_type _empty;
+      E _value;
+    };
+    _cell() noexcept
+        : seq(0)
+        , _empty()
+    {
+    }
+    _cell(const _cell &) = delete;
+    _cell &operator=(const _cell &) = delete;
+    ~_cell() {}  // NOLINT values are destroyed when dequeued
+  };
+  /* Coalescing slots: `_ctl` is generation << 2 | phase, where phase is free,
+  being claimed, or published. `_count` is generation << 32 | occurrences.
+  The consumer takes the occurrences it reported off `_count`, and if none
+  arrived meanwhile, retires the slot by bumping the generation in `_count`,
+  which fails any concurrent increments, then freeing `_ctl`.
+  */
+  struct _slot
+  {
+    std::atomic<uint64_t> _ctl{0};
+    std::atomic<uint64_t> _count{0};
+    std::atomic<const void *> _category{nullptr};
+    std::atomic<int> _value{0};
+  };
+  enum : uint64_t
+  {
+    _slot_free = 0,
+    _slot_claiming = 1,
+    _slot_published = 2,
+    _slot_phase_mask = 3
+  };
+
+  _cell *_ring;
+  size_t _mask;
+  _slot *_slots;
+  size_t _slots_mask;
+  alignas(_cache_line) std::atomic<size_t> _enqueue_pos{0};
+  std::atomic<size_t> _overflows{0};
+  alignas(_cache_line) size_t _dequeue_pos{0};
+
+  bool _push_ring(E &&e) noexcept
+  {
+    size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+    _cell *cell;
+    for(;;)
+    {
+      cell = &_ring[pos & _mask];
+      const size_t seq = cell->seq.load(std::memory_order_acquire);
+      const auto dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if(dif == 0)
+      {
+        if(_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          break;
+        }
+      }
+      else if(dif < 0)
+      {
+        _overflows.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      }
+      else
+      {
+        pos = _enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+    new(&cell->_value) E(static_cast<E &&>(e));  // NOLINT
+    cell->seq.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  static size_t _hash(const void *category, int value) noexcept
+  {
+    auto h = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(category) >> 4U) * 0x9E3779B97F4A7C15ULL;
+    h ^= static_cast<uint64_t>(static_cast<unsigned>(value)) * 0xC2B2AE3D27D4EB4FULL;
+    return static_cast<size_t>(h >> 32U);
+  }
+  // Returns true if coalesced into, or claimed, a table slot
+  template <class T = E> bool _coalesce(const T &e, std::true_type /*unused*/) noexcept
+  {
+    const void *category = &e.category();
+    const int value = e.value();
+    _slot &s = _slots[_hash(category, value) & _slots_mask];
+    uint64_t ctl = s._ctl.load(std::memory_order_acquire);
+    const uint64_t gen = ctl >> 2U;
+    switch(ctl & _slot_phase_mask)
+    {
+    case _slot_published:
+    {
+      if(s._category.load(std::memory_order_relaxed) != category || s._value.load(std::memory_order_relaxed) != value)
+      {
+        return false;
+      }
+      uint64_t count = s._count.load(std::memory_order_relaxed);
+      do
+      {
+        // Retired since, or would overflow
+        if((count >> 32U) != (gen & 0xffffffffU) || (count & 0xffffffffU) == 0xffffffffU)
+        {
+          return false;
+        }
+      } while(!s._count.compare_exchange_weak(count, count + 1, std::memory_order_relaxed));
+      return true;
+    }
+    case _slot_free:
+      if(!s._ctl.compare_exchange_strong(ctl, (gen << 2U) | _slot_claiming, std::memory_order_acquire, std::memory_order_relaxed))
+      {
+        return false;
+      }
+      s._category.store(category, std::memory_order_relaxed);
+      s._value.store(value, std::memory_order_relaxed);
+      s._count.store(((gen & 0xffffffffU) << 32U) | 1U, std::memory_order_relaxed);
+      s._ctl.store((gen << 2U) | _slot_published, std::memory_order_release);
+      return true;
+    default:
+      return false;
+    }
+  }
+  bool _coalesce(const E & /*unused*/, std::false_type /*unused*/) noexcept { return false; }
+
+  template <class F> size_t _drain_slots(F &f, size_t max, std::true_type /*unused*/)
+  {
+    using category_type = typename detail::error_channel_coalescing<E>::category_type;
+    size_t ret = 0;
+    for(size_t n = 0; n <= _slots_mask && ret < max; n++)
+    {
+      _slot &s = _slots[n];
+      const uint64_t ctl = s._ctl.load(std::memory_order_acquire);
+      if((ctl & _slot_phase_mask) != _slot_published)
+      {
+        continue;
+      }
+      const uint64_t gen = ctl >> 2U;
+      uint64_t count = s._count.load(std::memory_order_relaxed);
+      const uint64_t reported = count & 0xffffffffU;
+      const E e(s._value.load(std::memory_order_relaxed), *static_cast<const category_type *>(s._category.load(std::memory_order_relaxed)));
+      // If this throws, the slot is left as it was for the next drain
+      f(e, static_cast<size_t>(reported));
+      ++ret;
+      for(;;)
+      {
+        const uint64_t rest = (count & 0xffffffffU) - reported;
+        const uint64_t desired = (rest == 0) ? (((gen + 1) & 0xffffffffU) << 32U) : ((count & ~uint64_t(0xffffffffU)) | rest);
+        if(s._count.compare_exchange_weak(count, desired, std::memory_order_acq_rel, std::memory_order_relaxed))
+        {
+          if(rest == 0)
+          {
+            s._ctl.store(((gen + 1) << 2U) | _slot_free, std::memory_order_release);
+          }
+          break;
+        }
+      }
+    }
+    return ret;
+  }
+  template <class F> size_t _drain_slots(F & /*unused*/, size_t /*unused*/, std::false_type /*unused*/) { return 0; }
+
+public:
+  //! The error type.
+  using error_type = E;
+  //! Whether identical errors are coalesced.
+  static constexpr bool coalescing = _coalescing;
+
+  /*! Constructs a channel holding up to `capacity` uncoalesced errors, and `coalescing_slots`
+  distinct coalesced errors, both rounded up to powers of two.
+  */
+  explicit basic_error_channel(size_t capacity, size_t coalescing_slots = 64)
+      : _ring(new _cell[detail::error_channel_round_up(capacity)])
+      , _mask(detail::error_channel_round_up(capacity) - 1)
+      , _slots(_coalescing ? new _slot[detail::error_channel_round_up(coalescing_slots)] : nullptr)
+      , _slots_mask(_coalescing ? detail::error_channel_round_up(coalescing_slots) - 1 : 0)
+  {
+    for(size_t n = 0; n <= _mask; n++)
+    {
+      _ring[n].seq.store(n, std::memory_order_relaxed);
+    }
+  }
+  basic_error_channel(const basic_error_channel &) = delete;
+  basic_error_channel(basic_error_channel &&) = delete;
+  basic_error_channel &operator=(const basic_error_channel &) = delete;
+  basic_error_channel &operator=(basic_error_channel &&) = delete;
+  ~basic_error_channel()
+  {
+    drain([](const E & /*unused*/, size_t /*unused*/) {});
+    delete[] _ring;
+    delete[] _slots;
+  }
+
+  //! Pushes an error from any thread. Returns false, counting an overflow, if the channel is full.
+  bool push(E e) noexcept
+  {
+    if(_coalesce(e, std::integral_constant<bool, _coalescing>()))
+    {
+      return true;
+    }
+    return _push_ring(static_cast<E &&>(e));
+  }
+  //! Pushes the error of `r` from any thread, if it has one. Returns false only on overflow.
+  OUTCOME_TEMPLATE(class R)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(is_basic_result_v<R> && std::is_constructible<E, decltype(std::declval<const R &>().assume_error())>::value))
+  bool push(const R &r)
+  {
+    return r.has_error() ? push(E(r.assume_error())) : true;
+  }
+
+  /*! From the consumer thread only, calls `f(const E &, size_t count)` for up to `max`
+  entries, coalesced ones first, and returns how many there were. An entry is removed
+  only once `f` returns, so if `f` throws, that entry remains for the next drain.
+  */
+  template <class F> size_t drain(F &&f, size_t max = static_cast<size_t>(-1))
+  {
+    size_t ret = _drain_slots(f, max, std::integral_constant<bool, _coalescing>());
+    for(; ret < max; ++ret)
+    {
+      _cell *cell = &_ring[_dequeue_pos & _mask];
+      if(cell->seq.load(std::memory_order_acquire) != _dequeue_pos + 1)
+      {
+        break;
+      }
+      f(static_cast<const E &>(cell->_value), static_cast<size_t>(1));
+      cell->_value.~E();
+      cell->seq.store(_dequeue_pos + _mask + 1, std::memory_order_release);
+      ++_dequeue_pos;
+    }
+    return ret;
+  }
+
+  //! The number of errors which could not be stored since construction.
+  size_t overflows() const noexcept { return _overflows.load(std::memory_order_relaxed); }
+  //! The number of uncoalesced errors which can be stored.
+  size_t capacity() const noexcept { return _mask + 1; }
+};
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type alias error_channel. Potential doc page: `basic_error_channel<E>`
+*/
+using error_channel = basic_error_channel<std::error_code>;
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
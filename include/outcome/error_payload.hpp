@@ -0,0 +1,314 @@
+/* A lightweight refcounted error payload
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_ERROR_PAYLOAD_HPP
+#define OUTCOME_ERROR_PAYLOAD_HPP
+
+#include "success_failure.hpp"
+#include "trait.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+template <bool ThreadSafe> class basic_error_payload;
+
+namespace detail
+{
+  template <bool ThreadSafe> struct error_payload_refcount
+  {
+    std::atomic<size_t> _count{1};
+
+    void increment() noexcept { _count.fetch_add(1, std::memory_order_relaxed); }
+    bool decrement() noexcept { return _count.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+    size_t count() const noexcept { return _count.load(std::memory_order_relaxed); }
+  };
+  template <> struct error_payload_refcount<false>
+  {
+    size_t _count{1};
+
+    void increment() noexcept { ++_count; }
+    bool decrement() noexcept { return --_count == 0; }
+    size_t count() const noexcept { return _count; }
+  };
+
+  // A unique address per type, so payloads can be inspected without RTTI
+  template <class E> struct error_payload_type_id
+  {
+    static constexpr char id = 0;
+  };
+  template <class E> constexpr char error_payload_type_id<E>::id;
+
+  template <bool ThreadSafe> struct error_payload_node_base
+  {
+    error_payload_refcount<ThreadSafe> _refcount;
+    const void *_type;
+
+    explicit error_payload_node_base(const void *type) noexcept
+        : _type(type)
+    {
+    }
+    error_payload_node_base(const error_payload_node_base &) = delete;
+    error_payload_node_base &operator=(const error_payload_node_base &) = delete;
+    virtual ~error_payload_node_base() = default;
+    virtual void rethrow() const = 0;
+    virtual const char *what() const noexcept = 0;
+  };
+
+  template <class E, bool ThreadSafe> struct error_payload_node final : error_payload_node_base<ThreadSafe>
+  {
+    E _value;
+
+    template <class... Args>
+    explicit error_payload_node(Args &&... args)
+        : error_payload_node_base<ThreadSafe>(&error_payload_type_id<E>::id)
+        , _value(static_cast<Args &&>(args)...)
+    {
+    }
+    void rethrow() const override { OUTCOME_THROW_EXCEPTION(_value); }
+    const char *what() const noexcept override { return _what(&_value); }
+
+    static const char *_what(const std::exception *e) noexcept { return e->what(); }
+    static const char *_what(const void * /*unused*/) noexcept { return ""; }
+  };
+  // Wraps a std::exception_ptr, so anything std::current_exception() returns can be carried
+  template <bool ThreadSafe> struct error_payload_node<std::exception_ptr, ThreadSafe> final : error_payload_node_base<ThreadSafe>
+  {
+    std::exception_ptr _value;
+
+    explicit error_payload_node(std::exception_ptr v) noexcept
+        : error_payload_node_base<ThreadSafe>(&error_payload_type_id<std::exception_ptr>::id)
+        , _value(static_cast<std::exception_ptr &&>(v))
+    {
+    }
+    void rethrow() const override { std::rethrow_exception(_value); }
+    const char *what() const noexcept override
+    {
+#ifdef __cpp_exceptions
+      try
+      {
+        std::rethrow_exception(_value);
+      }
+      catch(const std::exception &e)
+      {
+        return e.what();
+      }
+      catch(...)
+      {
+      }
+#endif
+      return "";
+    }
+  };
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <bool ThreadSafe> basic_error_payload. Potential doc page: `basic_error_payload<ThreadSafe>`
+*/
+template <bool ThreadSafe> class OUTCOME_SYMBOL_VISIBLE basic_error_payload
+{
+  template <bool> friend class basic_error_payload;
+  using _node_base = detail::error_payload_node_base<ThreadSafe>;
+
+  _node_base *_node{nullptr};
+
+  explicit basic_error_payload(_node_base *node) noexcept
+      : _node(node)
+  {
+  }
+  void _release() noexcept
+  {
+    if(_node != nullptr && _node->_refcount.decrement())
+    {
+      delete _node;
+    }
+    _node = nullptr;
+  }
+
+public:
+  //! Whether copies may be made and released concurrently from multiple threads.
+  static constexpr bool thread_safe = ThreadSafe;
+
+  //! Constructs an empty payload.
+  constexpr basic_error_payload() noexcept = default;
+  //! Constructs an empty payload.
+  constexpr basic_error_payload(std::nullptr_t /*unused*/) noexcept {}  // NOLINT
+  //! Implicitly wraps a `std::exception_ptr`, or is empty if it is null.
+  basic_error_payload(std::exception_ptr e)  // NOLINT
+      : _node(e ? new detail::error_payload_node<std::exception_ptr, ThreadSafe>(static_cast<std::exception_ptr &&>(e)) : nullptr)
+  {
+  }
+  basic_error_payload(const basic_error_payload &o) noexcept
+      : _node(o._node)
+  {
+    if(_node != nullptr)
+    {
+      _node->_refcount.increment();
+    }
+  }
+  basic_error_payload(basic_error_payload &&o) noexcept
+      : _node(o._node)
+  {
+    o._node = nullptr;
+  }
+  basic_error_payload &operator=(const basic_error_payload &o) noexcept
+  {
+    _node_base *node = o._node;  // o may be *this
+    if(node != nullptr)
+    {
+      node->_refcount.increment();
+    }
+    _release();
+    _node = node;
+    return *this;
+  }
+  basic_error_payload &operator=(basic_error_payload &&o) noexcept
+  {
+    if(this != &o)
+    {
+      _release();
+      _node = o._node;
+      o._node = nullptr;
+    }
+    return *this;
+  }
+  ~basic_error_payload() { _release(); }
+
+  /*! Makes a payload holding an `E` constructed from `args`, with one allocation.
+  Unlike `std::make_exception_ptr()`, this never throws internally.
+  */
+  template <class E, class... Args> static basic_error_payload make(Args &&... args)
+  {
+    return basic_error_payload(new detail::error_payload_node<std::decay_t<E>, ThreadSafe>(static_cast<Args &&>(args)...));
+  }
+
+  //! True if not empty.
+  explicit operator bool() const noexcept { return _node != nullptr; }
+  //! The number of payloads sharing this one's object, or zero if empty. For diagnostics only.
+  size_t use_count() const noexcept { return _node != nullptr ? _node->_refcount.count() : 0; }
+  //! The `what()` of the object if it is a `std::exception`, otherwise an empty string.
+  const char *what() const noexcept { return _node != nullptr ? _node->what() : ""; }
+
+  //! A pointer to the object if it is exactly an `E`, otherwise null. Does not need RTTI.
+  template <class E> const E *get_if() const noexcept
+  {
+    if(_node == nullptr || _node->_type != &detail::error_payload_type_id<E>::id)
+    {
+      return nullptr;
+    }
+    return &static_cast<const detail::error_payload_node<E, ThreadSafe> *>(_node)->_value;
+  }
+
+  //! Throws a copy of the object, or rethrows the wrapped `std::exception_ptr`. Does nothing if empty.
+  void rethrow() const
+  {
+    if(_node != nullptr)
+    {
+      _node->rethrow();
+    }
+  }
+
+  //! Converts into a `std::exception_ptr`, which is expensive, so only for interoperation.
+  std::exception_ptr to_exception_ptr() const
+  {
+    if(_node == nullptr)
+    {
+      return {};
+    }
+    if(const std::exception_ptr *e = get_if<std::exception_ptr>())
+    {
+      return *e;
+    }
+#ifdef __cpp_exceptions
+    try
+    {
+      _node->rethrow();
+    }
+    catch(...)
+    {
+      return std::current_exception();
+    }
+#endif
+    return {};
+  }
+
+  friend bool operator==(const basic_error_payload &a, const basic_error_payload &b) noexcept { return a._node == b._node; }
+  friend bool operator!=(const basic_error_payload &a, const basic_error_payload &b) noexcept { return a._node != b._node; }
+  friend bool operator==(const basic_error_payload &a, std::nullptr_t /*unused*/) noexcept { return a._node == nullptr; }
+  friend bool operator!=(const basic_error_payload &a, std::nullptr_t /*unused*/) noexcept { return a._node != nullptr; }
+
+  friend void swap(basic_error_payload &a, basic_error_payload &b) noexcept
+  {
+    _node_base *t = a._node;
+    a._node = b._node;
+    b._node = t;
+  }
+
+  //! ADL discovered by `policy::exception_ptr()`. A payload is already its own exception pointer.
+  friend basic_error_payload make_exception_ptr(basic_error_payload v) noexcept { return v; }
+  //! ADL discovered by the `exception_ptr_rethrow` policies, to throw the payload on wide value access.
+  friend void rethrow_exception(const basic_error_payload &v) { v.rethrow(); }
+};
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type alias error_payload. Potential doc page: `basic_error_payload<ThreadSafe>`
+*/
+using error_payload = basic_error_payload<true>;
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type alias local_error_payload. Potential doc page: `basic_error_payload<ThreadSafe>`
+*/
+using local_error_payload = basic_error_payload<false>;
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class E, bool ThreadSafe = true, class... Args> inline basic_error_payload<ThreadSafe> make_error_payload(Args &&... args)
+{
+  return basic_error_payload<ThreadSafe>::template make<E>(static_cast<Args &&>(args)...);
+}
+
+namespace trait
+{
+  namespace detail
+  {
+    // Shortcut this for lower build impact
+    template <bool ThreadSafe> struct _is_exception_ptr_available<basic_error_payload<ThreadSafe>>
+    {
+      static constexpr bool value = true;
+      using type = basic_error_payload<ThreadSafe>;
+    };
+  }  // namespace detail
+
+  // basic_error_payload is an error type
+  template <bool ThreadSafe> struct is_error_type<basic_error_payload<ThreadSafe>>
+  {
+    static constexpr bool value = true;
+  };
+}  // namespace trait
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
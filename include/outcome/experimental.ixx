@@ -0,0 +1,74 @@
+/* The outcome.experimental C++ 20 module
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* A superset of the outcome module, adding status_result and status_outcome.
+It stands alone rather than importing the outcome module, because the headers
+it is made from include the ones the outcome module is made from, so import one
+or the other and never both into the same translation unit.
+
+status-code is a separate library, so it goes into the global module fragment
+like the standard library, and an importer wanting to name its types beyond
+those Outcome aliases into OUTCOME_V2_NAMESPACE::experimental should #include
+"outcome/experimental/status-code/include/system_error2.hpp" before importing.
+*/
+module;
+
+#include "detail/global_module_fragment.hpp"
+
+#include "experimental/status-code/include/system_error2.hpp"
+
+export module outcome.experimental;
+
+// Tell the headers we are generating the interface for the library
+#define GENERATING_OUTCOME_MODULE_INTERFACE
+#include "../outcome.hpp"
+#include "experimental/status_outcome.hpp"
+
+/* status_result.hpp brings status-code into experimental with a using
+directive, and using directives are not exported, so name the vocabulary types
+again with exported using declarations.
+*/
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+namespace experimental
+{
+  using SYSTEM_ERROR2_NAMESPACE::erased;
+  using SYSTEM_ERROR2_NAMESPACE::errored_status_code;
+  using SYSTEM_ERROR2_NAMESPACE::status_code;
+  using SYSTEM_ERROR2_NAMESPACE::status_code_domain;
+  using SYSTEM_ERROR2_NAMESPACE::status_error;
+
+  using SYSTEM_ERROR2_NAMESPACE::errc;
+  using SYSTEM_ERROR2_NAMESPACE::generic_code;
+  using SYSTEM_ERROR2_NAMESPACE::generic_error;
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+  using SYSTEM_ERROR2_NAMESPACE::posix_code;
+  using SYSTEM_ERROR2_NAMESPACE::posix_error;
+#endif
+  using SYSTEM_ERROR2_NAMESPACE::error;
+  using SYSTEM_ERROR2_NAMESPACE::system_code;
+
+  using SYSTEM_ERROR2_NAMESPACE::make_status_code;
+  using SYSTEM_ERROR2_NAMESPACE::make_status_code_ptr;
+}  // namespace experimental
+OUTCOME_V2_NAMESPACE_END
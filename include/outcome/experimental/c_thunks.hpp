@@ -0,0 +1,101 @@
+/* Generating C thunks for C++ functions returning status_result
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_EXPERIMENTAL_C_THUNKS_HPP
+#define OUTCOME_EXPERIMENTAL_C_THUNKS_HPP
+
+#include "result.h"
+#include "status_result.hpp"
+
+#include <cstring>  // for memcpy
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace experimental
+{
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  /* Converts a `status_result` into the C struct `CResult` declared for it with
+  `CXX_DECLARE_RESULT()`, which has the same layout. Ownership of the status
+  code passes to the C struct, as the C code cannot destroy it.
+  */
+  template <class CResult, class R, class S, class NoValuePolicy> inline CResult to_c_result(basic_result<R, S, NoValuePolicy> &&r) noexcept
+  {
+    using result_type = basic_result<R, S, NoValuePolicy>;
+    static_assert(sizeof(CResult) == sizeof(result_type), "The C result type does not match the size of the C++ result type");
+    static_assert(std::is_trivially_copyable<CResult>::value, "The C result type is not trivially copyable");
+    static_assert(std::is_nothrow_move_constructible<result_type>::value, "The C++ result type must be nothrow move constructible");
+    // Moved into storage which is never destroyed, then copied out bitwise
+    alignas(result_type) unsigned char buffer[sizeof(result_type)];
+    new(buffer) result_type(static_cast<result_type &&>(r));
+    CResult ret;
+    std::memcpy(&ret, buffer, sizeof(ret));
+    return ret;
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  /* Fills `results[n]` with `f(inputs[n])` converted by `to_c_result()`, for
+  each of `count` inputs, returning the number of errors.
+  */
+  template <class CResult, class T, class F> inline size_t to_c_results(const T *inputs, size_t count, CResult *results, F &&f) noexcept
+  {
+    size_t errors = 0;
+    for(size_t n = 0; n < count; n++)
+    {
+      results[n] = to_c_result<CResult>(f(inputs[n]));
+      errors += (results[n].flags >> 1U) & 1U;
+    }
+    return errors;
+  }
+}  // namespace experimental
+
+OUTCOME_V2_NAMESPACE_END
+
+/* Defines `extern "C" CXX_RESULT(ident) c_name params`, which returns
+`cxx_function args` converted to the C struct. `params` and `args` are
+parenthesised lists, say `(char *buffer, size_t len)` and `(buffer, len)`.
+`cxx_function` should be `noexcept`, as exceptions cannot cross into C.
+*/
+#define CXX_DEFINE_RESULT_THUNK(ident, c_name, cxx_function, params, args)                                                                                                                                                                                                                                                     \
+  extern "C" CXX_RESULT(ident) c_name params { return OUTCOME_V2_NAMESPACE::experimental::to_c_result<CXX_RESULT(ident)>(cxx_function args); }
+
+/* Defines `extern "C" size_t c_name(const input_type *inputs, size_t count, CXX_RESULT(ident) *results)`,
+which calls `cxx_function(inputs[n])` for each input in one crossing of the
+boundary, fills `results`, and returns the number of errors.
+*/
+#define CXX_DEFINE_RESULT_BATCH_THUNK(ident, c_name, cxx_function, input_type)                                                                                                                                                                                                                                                 \
+  extern "C" size_t c_name(const input_type *inputs, size_t count, CXX_RESULT(ident) * results)                                                                                                                                                                                                                                \
+  {                                                                                                                                                                                                                                                                                                                            \
+    return OUTCOME_V2_NAMESPACE::experimental::to_c_results(inputs, count, results, [](const input_type &i) { return cxx_function(i); });                                                                                                                                                                                      \
+  }
+
+#define CXX_DEFINE_RESULT_SYSTEM_THUNK(ident, c_name, cxx_function, params, args) CXX_DEFINE_RESULT_THUNK(system_##ident, c_name, cxx_function, params, args)
+#define CXX_DEFINE_RESULT_SYSTEM_BATCH_THUNK(ident, c_name, cxx_function, input_type) CXX_DEFINE_RESULT_BATCH_THUNK(system_##ident, c_name, cxx_function, input_type)
+#define CXX_DEFINE_RESULT_ERRNO_THUNK(ident, c_name, cxx_function, params, args) CXX_DEFINE_RESULT_THUNK(posix_##ident, c_name, cxx_function, params, args)
+#define CXX_DEFINE_RESULT_ERRNO_BATCH_THUNK(ident, c_name, cxx_function, input_type) CXX_DEFINE_RESULT_BATCH_THUNK(posix_##ident, c_name, cxx_function, input_type)
+
+#endif
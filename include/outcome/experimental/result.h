@@ -25,6 +25,7 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef OUTCOME_EXPERIMENTAL_RESULT_H
 #define OUTCOME_EXPERIMENTAL_RESULT_H
 
+#include <stddef.h>  // for size_t
 #include <stdint.h>  // for intptr_t
 
 #define CXX_DECLARE_RESULT(ident, R, S)                                                                                                                                                                                                                                                                                        \
@@ -44,6 +45,33 @@ Distributed under the Boost Software License, Version 1.0.
 
 #define CXX_RESULT_ERROR_IS_ERRNO(r) (((r).flags & (1U << 4U)) == (1U << 4U))
 
+/* Declares `cxx_result_<ident>_count_errors()` and `cxx_result_<ident>_first_error()`
+for arrays of `CXX_RESULT(ident)`, say as filled by a batch thunk. The first
+error is `count` if there is none.
+*/
+#define CXX_DECLARE_RESULT_BATCH(ident)                                                                                                                                                                                                                                                                                        \
+  static inline size_t cxx_result_##ident##_count_errors(const struct cxx_result_##ident *r, size_t count)                                                                                                                                                                                                                     \
+  {                                                                                                                                                                                                                                                                                                                            \
+    size_t ret = 0, n;                                                                                                                                                                                                                                                                                                         \
+    for(n = 0; n < count; n++)                                                                                                                                                                                                                                                                                                 \
+    {                                                                                                                                                                                                                                                                                                                          \
+      ret += (r[n].flags >> 1U) & 1U;                                                                                                                                                                                                                                                                                          \
+    }                                                                                                                                                                                                                                                                                                                          \
+    return ret;                                                                                                                                                                                                                                                                                                                \
+  }                                                                                                                                                                                                                                                                                                                            \
+  static inline size_t cxx_result_##ident##_first_error(const struct cxx_result_##ident *r, size_t count)                                                                                                                                                                                                                      \
+  {                                                                                                                                                                                                                                                                                                                            \
+    size_t n;                                                                                                                                                                                                                                                                                                                  \
+    for(n = 0; n < count && (r[n].flags & 2U) == 0U; n++)                                                                                                                                                                                                                                                                      \
+    {                                                                                                                                                                                                                                                                                                                          \
+    }                                                                                                                                                                                                                                                                                                                          \
+    return n;                                                                                                                                                                                                                                                                                                                  \
+  }
+
+#define CXX_RESULT_COUNT_ERRORS(ident, r, count) cxx_result_##ident##_count_errors((r), (count))
+
+#define CXX_RESULT_FIRST_ERROR(ident, r, count) cxx_result_##ident##_first_error((r), (count))
+
 
 /***************************** <system_error2> support ******************************/
 
@@ -64,6 +92,9 @@ struct cxx_status_code_posix
 };
 #define CXX_DECLARE_RESULT_ERRNO(ident, R) CXX_DECLARE_RESULT(posix_##ident, R, struct cxx_status_code_posix)
 #define CXX_RESULT_ERRNO(ident) CXX_RESULT(posix_##ident)
+#define CXX_DECLARE_RESULT_ERRNO_BATCH(ident) CXX_DECLARE_RESULT_BATCH(posix_##ident)
+#define CXX_RESULT_ERRNO_COUNT_ERRORS(ident, r, count) CXX_RESULT_COUNT_ERRORS(posix_##ident, r, count)
+#define CXX_RESULT_ERRNO_FIRST_ERROR(ident, r, count) CXX_RESULT_FIRST_ERROR(posix_##ident, r, count)
 
 struct cxx_status_code_system
 {
@@ -72,5 +103,8 @@ struct cxx_status_code_system
 };
 #define CXX_DECLARE_RESULT_SYSTEM(ident, R) CXX_DECLARE_RESULT(system_##ident, R, struct cxx_status_code_system)
 #define CXX_RESULT_SYSTEM(ident) CXX_RESULT(system_##ident)
+#define CXX_DECLARE_RESULT_SYSTEM_BATCH(ident) CXX_DECLARE_RESULT_BATCH(system_##ident)
+#define CXX_RESULT_SYSTEM_COUNT_ERRORS(ident, r, count) CXX_RESULT_COUNT_ERRORS(system_##ident, r, count)
+#define CXX_RESULT_SYSTEM_FIRST_ERROR(ident, r, count) CXX_RESULT_FIRST_ERROR(system_##ident, r, count)
 
 #endif
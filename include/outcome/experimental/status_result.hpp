@@ -26,6 +26,8 @@ Distributed under the Boost Software License, Version 1.0.
 #define OUTCOME_EXPERIMENTAL_STATUS_RESULT_HPP
 
 #include "../basic_result.hpp"
+#include "../detail/message_cache.hpp"
+#include "../errno_tables.hpp"
 #include "../policy/fail_to_compile_observers.hpp"
 
 #include "status-code/include/system_error2.hpp"
@@ -83,6 +85,32 @@ namespace detail
     state._status.set_have_error_is_errno(true);
   }
 
+  // Customise _error_equal. Generic and POSIX codes equal an errc exactly when
+  // their values are equal, so the domain's virtual equivalence is not needed.
+  OUTCOME_TEMPLATE(class State, class DomainType)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_integral<typename SYSTEM_ERROR2_NAMESPACE::status_code<DomainType>::value_type>::value ||
+                                  std::is_enum<typename SYSTEM_ERROR2_NAMESPACE::status_code<DomainType>::value_type>::value))
+  inline bool _error_equal(const State & /*unused*/, const SYSTEM_ERROR2_NAMESPACE::status_code<DomainType> &a, const SYSTEM_ERROR2_NAMESPACE::errc &b) noexcept
+  {
+    if(!a.empty() && (a.domain() == SYSTEM_ERROR2_NAMESPACE::generic_code_domain
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+                      || a.domain() == SYSTEM_ERROR2_NAMESPACE::posix_code_domain
+#endif
+                      ))
+    {
+      return static_cast<int>(a.value()) == static_cast<int>(b);
+    }
+    return a == b;
+  }
+  OUTCOME_TEMPLATE(class State, class DomainType)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_integral<typename SYSTEM_ERROR2_NAMESPACE::status_code<DomainType>::value_type>::value ||
+                                  std::is_enum<typename SYSTEM_ERROR2_NAMESPACE::status_code<DomainType>::value_type>::value))
+  inline bool _error_not_equal(const State &state, const SYSTEM_ERROR2_NAMESPACE::status_code<DomainType> &a, const SYSTEM_ERROR2_NAMESPACE::errc &b) noexcept
+  {
+    return !_error_equal(state, a, b);
+  }
+
+  struct status_code_messages;
 }  // namespace detail
 
 namespace experimental
@@ -141,6 +169,110 @@ SIGNATURE NOT RECOGNISED
   template <class R, class S = system_code, class NoValuePolicy = policy::default_status_result_policy<R, S>>  //
   using status_result = basic_result<R, S, NoValuePolicy>;
 
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  /* Returns `code.message()` interned by domain id and value, for status codes
+  with integral or enum values such as `system_code`, `generic_code` and
+  `posix_code`, so only the first call for each allocates. As with the
+  `std::error_code` overload, an interned message lives for the rest of the
+  program, and at most `OUTCOME_MESSAGE_CACHE_MAX_ENTRIES` are interned.
+  */
+  OUTCOME_TEMPLATE(class DomainType)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_integral<typename status_code<DomainType>::value_type>::value || std::is_enum<typename status_code<DomainType>::value_type>::value))
+  inline cached_message_type cached_message(const status_code<DomainType> &code)
+  {
+    if(code.empty())
+    {
+      static const std::string empty;
+      return cached_message_type(&empty);
+    }
+    return OUTCOME_V2_NAMESPACE::detail::message_cache<OUTCOME_V2_NAMESPACE::detail::status_code_messages>::get(code.domain().id(), static_cast<intptr_t>(code.value()), [&code] {
+      auto msg = code.message();
+      return std::string(msg.data(), msg.size());
+    });
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  /* Makes a `system_code` for errno value `v`, in the generic domain if `v` is
+  some `errc`, which is found from a compile time table, otherwise in the
+  POSIX domain. Without the POSIX domain, it is always in the generic domain.
+  */
+  inline system_code errno_code(int v) noexcept
+  {
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+    if(!errno_is_errc(v))
+    {
+      return posix_code(v);
+    }
+#endif
+    return generic_code(static_cast<errc>(v));
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <size_t Bytes> small_status_code_buffer. Potential doc page: NOT FOUND
+*/
+  /* The erased value type of `small_status_code<Bytes>`, an inline buffer of
+  `Bytes` bytes aligned as `intptr_t`, into which the value of any status code
+  fitting it is bit copied.
+  */
+  template <size_t Bytes> struct small_status_code_buffer
+  {
+    static_assert(Bytes > 0 && Bytes % sizeof(intptr_t) == 0, "The size of a small status code buffer must be a non-zero multiple of sizeof(intptr_t)");
+    alignas(intptr_t) unsigned char bytes[Bytes];
+  };
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type alias template <size_t Bytes> small_status_code. Potential doc page: NOT FOUND
+*/
+  /* An erased status code which can hold the value of any status code up to
+  `Bytes` bytes, say an errno plus a file offset plus an object id, without
+  allocating. As with `system_code`, values which are not trivially copyable
+  need `traits::is_move_bitcopying` specialised, and are copied by `clone()`
+  and destroyed by their domain's `_do_erased_copy()` and `_do_erased_destroy()`.
+  */
+  template <size_t Bytes> using small_status_code = status_code<erased<small_status_code_buffer<Bytes>>>;
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <class StatusCode, size_t Bytes> fits_small_status_code. Potential doc page: NOT FOUND
+*/
+  /* True if `StatusCode` can be erased into a `small_status_code<Bytes>`.
+  */
+  template <class StatusCode, size_t Bytes>
+  struct fits_small_status_code
+      : std::integral_constant<bool, SYSTEM_ERROR2_NAMESPACE::detail::type_erasure_is_safe<small_status_code_buffer<Bytes>, typename StatusCode::value_type>::value  //
+                                     && alignof(typename StatusCode::value_type) <= alignof(intptr_t)>
+  {
+  };
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  /* Erases `v` into a `small_status_code<Bytes>`, failing to compile with a
+  readable message if its value exceeds the size budget `Bytes`. Conversion is
+  otherwise implicit, but a status code which does not fit simply does not
+  convert.
+  */
+  template <size_t Bytes, class DomainType> inline small_status_code<Bytes> to_small_status_code(status_code<DomainType> &&v) noexcept
+  {
+    using value_type = typename DomainType::value_type;
+    static_assert(traits::is_move_bitcopying<value_type>::value, "The status code value must be trivially copyable, or specialise traits::is_move_bitcopying");
+    static_assert(sizeof(value_type) <= Bytes, "The status code value exceeds the size budget of the small status code");
+    static_assert(alignof(value_type) <= alignof(intptr_t), "The status code value is more aligned than the small status code buffer");
+    return small_status_code<Bytes>(static_cast<status_code<DomainType> &&>(v));
+  }
+
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+  /* A `status_result` whose error is a `small_status_code<Bytes>`, carrying up
+  to `Bytes` bytes of error payload inline.
+  */
+  template <class R, size_t Bytes, class NoValuePolicy = policy::default_status_result_policy<R, small_status_code<Bytes>>>  //
+  using small_status_result = basic_result<R, small_status_code<Bytes>, NoValuePolicy>;
+
 }  // namespace experimental
 
 OUTCOME_V2_NAMESPACE_END
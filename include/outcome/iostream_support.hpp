@@ -25,12 +25,13 @@ Distributed under the Boost Software License, Version 1.0.
 #ifndef OUTCOME_IOSTREAM_SUPPORT_HPP
 #define OUTCOME_IOSTREAM_SUPPORT_HPP
 
+#include "message_cache.hpp"
 #include "outcome.hpp"
 
 #include <iostream>
 #include <sstream>
 
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 namespace detail
 {
@@ -98,8 +99,8 @@ namespace detail
   }
   OUTCOME_TEMPLATE(class T)
   OUTCOME_TREQUIRES(OUTCOME_TPRED(!std::is_constructible<std::error_code, T>::value))
-  inline std::string safe_message(T && /*unused*/) { return {}; }
-  inline std::string safe_message(const std::error_code &ec) { return " (" + ec.message() + ")"; }
+  inline void safe_message(std::ostream & /*unused*/, T && /*unused*/) {}
+  inline void safe_message(std::ostream &s, const std::error_code &ec) { s << " (" << cached_message(ec).str() << ")"; }
 }  // namespace detail
 
 /*! AWAITING HUGO JSON CONVERSION TOOL
@@ -142,7 +143,8 @@ template <class R, class S, class P> inline std::string print(const basic_result
   }
   if(v.has_error())
   {
-    s << v.error() << detail::safe_message(v.error());
+    s << v.error();
+    detail::safe_message(s, v.error());
   }
   return s.str();
 }
@@ -158,7 +160,8 @@ template <class S, class P> inline std::string print(const basic_result<void, S,
   }
   if(v.has_error())
   {
-    s << v.error() << detail::safe_message(v.error());
+    s << v.error();
+    detail::safe_message(s, v.error());
   }
   return s.str();
 }
@@ -276,4 +279,11 @@ template <class R, class S, class P, class N> inline std::string print(const out
 }
 OUTCOME_V2_NAMESPACE_END
 
+#include "detail/extern_templates.hpp"
+#if OUTCOME_USE_EXTERN_TEMPLATES
+OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_EXTERN_TEMPLATE_TYPES(OUTCOME_EXTERN_TEMPLATE_PRINT)
+OUTCOME_V2_NAMESPACE_END
+#endif
+
 #endif
@@ -0,0 +1,60 @@
+/* Interned messages of std::error_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_MESSAGE_CACHE_HPP
+#define OUTCOME_MESSAGE_CACHE_HPP
+
+#include "detail/message_cache.hpp"
+
+#include <system_error>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  struct std_error_code_messages
+  {
+    const std::error_code &ec;
+    std::string operator()() const { return ec.message(); }
+  };
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+/* Returns `ec.message()` interned, so only the first call for each category
+and value allocates and asks the category. Lookups are lock free, and an
+interned message lives for the rest of the program. Messages are remembered
+as first made, so later changes of locale are not reflected. Once
+`OUTCOME_MESSAGE_CACHE_MAX_ENTRIES` messages are interned, new ones are made
+uncached on every call.
+*/
+inline cached_message_type cached_message(const std::error_code &ec)
+{
+  return detail::message_cache<detail::std_error_code_messages>::get(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&ec.category())), ec.value(), detail::std_error_code_messages{ec});
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -38,4 +38,11 @@ using outcome = std_outcome<R, S, P, NoValuePolicy>;
 
 OUTCOME_V2_NAMESPACE_END
 
+#include "detail/extern_templates.hpp"
+#if OUTCOME_USE_EXTERN_TEMPLATES
+OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_EXTERN_TEMPLATE_TYPES(OUTCOME_EXTERN_TEMPLATE_OUTCOME)
+OUTCOME_V2_NAMESPACE_END
+#endif
+
 #endif
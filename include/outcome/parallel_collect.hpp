@@ -0,0 +1,231 @@
+/* Transforming ranges into results in parallel
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_PARALLEL_COLLECT_HPP
+#define OUTCOME_PARALLEL_COLLECT_HPP
+
+#include "collect.hpp"
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  template <class Range, class F> using parallel_collect_result_type = std::decay_t<decltype(std::declval<F &>()(*std::begin(std::declval<Range &>())))>;
+
+  // Where one worker failed, if it did, and how
+  template <class Failure> struct parallel_collect_worker
+  {
+    size_t failed_at{static_cast<size_t>(-1)};
+    union {
+      empty_type _empty;
+      Failure failure;
+    };
+#ifdef __cpp_exceptions
+    std::exception_ptr exception;
+#endif
+    parallel_collect_worker() noexcept
+        : _empty()
+    {
+    }
+    parallel_collect_worker(const parallel_collect_worker &) = delete;
+    parallel_collect_worker(parallel_collect_worker &&) = delete;
+    parallel_collect_worker &operator=(const parallel_collect_worker &) = delete;
+    parallel_collect_worker &operator=(parallel_collect_worker &&) = delete;
+    ~parallel_collect_worker()
+    {
+      if(failed_at != static_cast<size_t>(-1)
+#ifdef __cpp_exceptions
+         && !exception
+#endif
+      )
+      {
+        failure.~Failure();
+      }
+    }
+  };
+
+  inline void parallel_collect_lower(std::atomic<size_t> &first_failure, size_t idx) noexcept
+  {
+    size_t v = first_failure.load(std::memory_order_relaxed);
+    while(idx < v && !first_failure.compare_exchange_weak(v, idx, std::memory_order_relaxed))
+    {
+    }
+  }
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+/* Calls `f`, which must be safe to call concurrently, on every element of the
+random access `range` across `threads` threads, the calling thread being one
+of them, and collects the values of the returned `basic_result` or
+`basic_outcome` into a result of a `std::vector`. Zero `threads` means
+`std::thread::hardware_concurrency()`. If a thread cannot be started, the
+work is done by those already running and the calling thread.
+
+Threads claim chunks of `chunk` consecutive elements, zero choosing a size
+giving each thread several chunks. As soon as any element fails, elements
+after it are skipped by all threads, but those before it are still done, so
+the failure returned is always that of the lowest failing index, as if done
+serially. If `f` throws, the exception of the lowest throwing index is
+rethrown on the calling thread after all threads have stopped.
+
+The value type must be default constructible, as the vector is sized up
+front and each thread assigns its own elements.
+*/
+OUTCOME_TEMPLATE(class Range, class F, class R = detail::parallel_collect_result_type<Range, F>)
+OUTCOME_TREQUIRES(OUTCOME_TEXPR(std::declval<R &&>().as_failure()), OUTCOME_TEXPR(std::declval<R &&>().assume_value()))
+inline detail::collect_rebind_t<R, std::vector<typename R::value_type>> parallel_transform_collect(Range &&range, F &&f, size_t threads = 0, size_t chunk = 0)
+{
+  using value_type = typename R::value_type;
+  using failure_type = decltype(std::declval<R &&>().as_failure());
+  using worker_type = detail::parallel_collect_worker<failure_type>;
+  static_assert(std::is_default_constructible<value_type>::value, "parallel_transform_collect() requires a default constructible value type");
+  static_assert(!std::is_same<value_type, bool>::value, "std::vector<bool> cannot be written by many threads at once");
+  const auto first = std::begin(range);
+  const auto count = static_cast<size_t>(std::end(range) - first);
+  if(count == 0)
+  {
+    return std::vector<value_type>();
+  }
+  if(threads == 0)
+  {
+    threads = std::thread::hardware_concurrency();
+  }
+  if(threads == 0)
+  {
+    threads = 1;
+  }
+  if(chunk == 0)
+  {
+    chunk = count / (threads * 8);
+    if(chunk == 0)
+    {
+      chunk = 1;
+    }
+  }
+  if(threads > (count + chunk - 1) / chunk)
+  {
+    threads = (count + chunk - 1) / chunk;
+  }
+
+  std::vector<value_type> values(count);
+  std::atomic<size_t> next{0}, first_failure{count};
+  std::vector<worker_type> workers(threads);
+  auto work = [&](worker_type &w) {
+    for(;;)
+    {
+      const size_t begin = next.fetch_add(chunk, std::memory_order_relaxed);
+      // Chunks are claimed in order, so if this one starts after a failure, so do all later ones
+      if(begin >= count || begin > first_failure.load(std::memory_order_relaxed))
+      {
+        return;
+      }
+      const size_t end = (count - begin < chunk) ? count : begin + chunk;
+      for(size_t idx = begin; idx < end; ++idx)
+      {
+        if(idx > first_failure.load(std::memory_order_relaxed))
+        {
+          return;
+        }
+#ifdef __cpp_exceptions
+        try
+        {
+#endif
+          R r = f(first[idx]);
+          if(r.has_value())
+          {
+            values[idx] = static_cast<R &&>(r).assume_value();
+            continue;
+          }
+          // A worker stops at its first failure, so records at most one
+          new(&w.failure) failure_type(static_cast<R &&>(r).as_failure());  // NOLINT
+          w.failed_at = idx;
+#ifdef __cpp_exceptions
+        }
+        catch(...)
+        {
+          w.exception = std::current_exception();
+          w.failed_at = idx;
+        }
+#endif
+        detail::parallel_collect_lower(first_failure, idx);
+        return;
+      }
+    }
+  };
+  {
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+#ifdef __cpp_exceptions
+    try
+    {
+#endif
+      for(size_t n = 1; n < threads; n++)
+      {
+        pool.emplace_back(work, std::ref(workers[n]));
+      }
+#ifdef __cpp_exceptions
+    }
+    catch(...)
+    {
+      // If no more threads can be started, those which did share out the chunks with this thread
+    }
+#endif
+    work(workers[0]);
+    for(auto &t : pool)
+    {
+      t.join();
+    }
+  }
+  const size_t failed_at = first_failure.load(std::memory_order_relaxed);
+  if(failed_at != count)
+  {
+    for(auto &w : workers)
+    {
+      if(w.failed_at == failed_at)
+      {
+#ifdef __cpp_exceptions
+        if(w.exception)
+        {
+          std::rethrow_exception(w.exception);
+        }
+#endif
+        return static_cast<failure_type &&>(w.failure);
+      }
+    }
+  }
+  return static_cast<std::vector<value_type> &&>(values);
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,269 @@
+/* A bump allocator for error payloads
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_PAYLOAD_ARENA_HPP
+#define OUTCOME_PAYLOAD_ARENA_HPP
+
+#include "config.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  payload_arena. Potential doc page: `payload_arena`
+*/
+/* Error types which carry a payload, such as the paths in the
+`outcome_payload.cpp` snippet, usually allocate it, once per failure. A
+`payload_arena` instead bump allocates out of large chunks, and frees
+nothing until `reset()` or `release()`, typically when the request or the
+thread's unit of work completes. So a failure costs a pointer increment,
+and a request a few chunk allocations at most.
+
+Install one for the current thread with `payload_arena_scope`, and hold the
+payload in an `arena_string`, or anything else using `payload_arena_allocator`.
+The arena is not thread safe, so allocate from it only on the thread it is
+installed on, and nothing allocated from it may be used after it is reset.
+*/
+class OUTCOME_SYMBOL_VISIBLE payload_arena
+{
+  struct _chunk
+  {
+    _chunk *next;
+    size_t size;  // of the data following this header
+  };
+  static constexpr size_t _header_size = (sizeof(_chunk) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+  _chunk *_chunks{nullptr};  // most recent first
+  char *_initial{nullptr}, *_initial_end{nullptr};
+  char *_cur{nullptr}, *_end{nullptr};
+  size_t _chunk_size;
+  size_t _bytes_used{0};
+
+  static char *_data(_chunk *c) noexcept { return reinterpret_cast<char *>(c) + _header_size; }
+  void _add_chunk(size_t bytes)
+  {
+    size_t size = (bytes > _chunk_size) ? bytes : _chunk_size;
+    auto *c = static_cast<_chunk *>(::operator new(_header_size + size));
+    c->next = _chunks;
+    c->size = size;
+    _chunks = c;
+    _cur = _data(c);
+    _end = _cur + size;
+  }
+  void _free_chunks(_chunk *c) noexcept
+  {
+    while(c != nullptr)
+    {
+      _chunk *next = c->next;
+      ::operator delete(c);
+      c = next;
+    }
+  }
+
+public:
+  //! The default size of each chunk allocated.
+  static constexpr size_t default_chunk_size = 4096;
+
+  //! Constructs an arena allocating chunks of `chunk_size` bytes when needed.
+  explicit payload_arena(size_t chunk_size = default_chunk_size) noexcept
+      : _chunk_size(chunk_size)
+  {
+  }
+  //! Constructs an arena allocating from `buffer` first, which it does not own, such as a buffer on the stack.
+  payload_arena(void *buffer, size_t bytes, size_t chunk_size = default_chunk_size) noexcept
+      : _initial(static_cast<char *>(buffer))
+      , _initial_end(static_cast<char *>(buffer) + bytes)
+      , _cur(_initial)
+      , _end(_initial_end)
+      , _chunk_size(chunk_size)
+  {
+  }
+  payload_arena(const payload_arena &) = delete;
+  payload_arena &operator=(const payload_arena &) = delete;
+  ~payload_arena() { _free_chunks(_chunks); }
+
+  //! Returns `bytes` aligned to `align`, which must be a power of two. Never returns null.
+  void *allocate(size_t bytes, size_t align = alignof(std::max_align_t))
+  {
+    auto p = reinterpret_cast<uintptr_t>(_cur);
+    auto aligned = (p + align - 1) & ~static_cast<uintptr_t>(align - 1);
+    if(_cur == nullptr || aligned + bytes > reinterpret_cast<uintptr_t>(_end))
+    {
+      _add_chunk(bytes + align);
+      p = reinterpret_cast<uintptr_t>(_cur);
+      aligned = (p + align - 1) & ~static_cast<uintptr_t>(align - 1);
+    }
+    _cur = reinterpret_cast<char *>(aligned + bytes);
+    _bytes_used += bytes;
+    return reinterpret_cast<void *>(aligned);
+  }
+
+  //! Frees everything allocated, but keeps the most recent chunk for reuse.
+  void reset() noexcept
+  {
+    if(_chunks != nullptr)
+    {
+      _free_chunks(_chunks->next);
+      _chunks->next = nullptr;
+      _cur = _data(_chunks);
+      _end = _cur + _chunks->size;
+    }
+    else
+    {
+      _cur = _initial;
+      _end = _initial_end;
+    }
+    _bytes_used = 0;
+  }
+  //! Frees everything allocated, and all the chunks.
+  void release() noexcept
+  {
+    _free_chunks(_chunks);
+    _chunks = nullptr;
+    _cur = _initial;
+    _end = _initial_end;
+    _bytes_used = 0;
+  }
+
+  //! The bytes allocated since construction or the last reset, excluding alignment padding.
+  size_t bytes_used() const noexcept { return _bytes_used; }
+  //! The number of chunks currently held, excluding any initial buffer.
+  size_t chunks() const noexcept
+  {
+    size_t ret = 0;
+    for(_chunk *c = _chunks; c != nullptr; c = c->next)
+    {
+      ++ret;
+    }
+    return ret;
+  }
+};
+
+namespace detail
+{
+  inline payload_arena *&current_payload_arena_ref() noexcept
+  {
+    static OUTCOME_THREAD_LOCAL payload_arena *v;
+    return v;
+  }
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+inline payload_arena *current_payload_arena() noexcept { return detail::current_payload_arena_ref(); }
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  payload_arena_scope. Potential doc page: `payload_arena_scope`
+*/
+//! Installs an arena as the calling thread's current one until destruction, when the previous one is restored. Nestable.
+class payload_arena_scope
+{
+  payload_arena *_previous;
+
+public:
+  explicit payload_arena_scope(payload_arena &arena) noexcept
+      : _previous(detail::current_payload_arena_ref())
+  {
+    detail::current_payload_arena_ref() = &arena;
+  }
+  payload_arena_scope(const payload_arena_scope &) = delete;
+  payload_arena_scope &operator=(const payload_arena_scope &) = delete;
+  ~payload_arena_scope() { detail::current_payload_arena_ref() = _previous; }
+};
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <class T> payload_arena_allocator. Potential doc page: `payload_arena_allocator<T>`
+*/
+/* Allocates from the arena current on the thread when it was default
+constructed, or from the heap if there was none. Deallocation into an arena
+does nothing.
+
+Copy constructing a container using this takes the arena current on the
+thread at the time of the copy, not the one of the container copied. So a
+payload copied out of a request's scope, say to be logged after the request
+completes, copies onto the heap and does not dangle when the arena is reset.
+Moves keep the arena's memory.
+*/
+template <class T> class payload_arena_allocator
+{
+  template <class U> friend class payload_arena_allocator;
+  payload_arena *_arena;
+
+public:
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::false_type;
+
+  //! Allocates from the calling thread's current arena, or from the heap if none.
+  payload_arena_allocator() noexcept
+      : _arena(current_payload_arena())
+  {
+  }
+  //! Allocates from `arena`, or from the heap if null.
+  explicit payload_arena_allocator(payload_arena *arena) noexcept
+      : _arena(arena)
+  {
+  }
+  template <class U>
+  payload_arena_allocator(const payload_arena_allocator<U> &o) noexcept  // NOLINT
+      : _arena(o._arena)
+  {
+  }
+
+  //! The arena allocated from, or null for the heap.
+  payload_arena *arena() const noexcept { return _arena; }
+
+  T *allocate(size_t n)
+  {
+    if(_arena != nullptr)
+    {
+      return static_cast<T *>(_arena->allocate(n * sizeof(T), alignof(T)));
+    }
+    return static_cast<T *>(::operator new(n * sizeof(T)));
+  }
+  void deallocate(T *p, size_t /*unused*/) noexcept
+  {
+    if(_arena == nullptr)
+    {
+      ::operator delete(p);
+    }
+  }
+  payload_arena_allocator select_on_container_copy_construction() const noexcept { return payload_arena_allocator(); }
+
+  template <class U> friend bool operator==(const payload_arena_allocator &a, const payload_arena_allocator<U> &b) noexcept { return a._arena == b.arena(); }
+  template <class U> friend bool operator!=(const payload_arena_allocator &a, const payload_arena_allocator<U> &b) noexcept { return a._arena != b.arena(); }
+};
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type alias arena_string. Potential doc page: `payload_arena_allocator<T>`
+*/
+using arena_string = std::basic_string<char, std::char_traits<char>, payload_arena_allocator<char>>;
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
@@ -47,4 +47,12 @@ template <class R, class S = std::error_code> using checked = result<R, S, polic
 
 OUTCOME_V2_NAMESPACE_END
 
+#include "detail/extern_templates.hpp"
+#if OUTCOME_USE_EXTERN_TEMPLATES
+OUTCOME_V2_NAMESPACE_BEGIN
+extern template class bad_result_access_with<std::error_code>;
+OUTCOME_EXTERN_TEMPLATE_TYPES(OUTCOME_EXTERN_TEMPLATE_RESULT)
+OUTCOME_V2_NAMESPACE_END
+#endif
+
 #endif
@@ -0,0 +1,337 @@
+/* A one-shot result channel between threads
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_SHARED_RESULT_HPP
+#define OUTCOME_SHARED_RESULT_HPP
+
+#include "result.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  /* Blocks while `*addr == expected`, for at most `timeout_ns` if not negative.
+  May return spuriously, so callers recheck. Uses a futex on Linux, elsewhere
+  it backs off with yields and short sleeps.
+  */
+  inline void futex_wait(std::atomic<uint32_t> *addr, uint32_t expected, int64_t timeout_ns) noexcept
+  {
+#ifdef __linux__
+    struct timespec ts, *pts = nullptr;
+    if(timeout_ns >= 0)
+    {
+      ts.tv_sec = static_cast<time_t>(timeout_ns / 1000000000);
+      ts.tv_nsec = static_cast<long>(timeout_ns % 1000000000);
+      pts = &ts;
+    }
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t *>(addr), FUTEX_WAIT_PRIVATE, expected, pts, nullptr, 0);
+#else
+    static constexpr int64_t max_sleep_ns = 1000000;  // 1ms
+    for(int64_t slept = 0, n = 0; addr->load(std::memory_order_acquire) == expected && (timeout_ns < 0 || slept < timeout_ns); n++)
+    {
+      if(n < 64)
+      {
+        std::this_thread::yield();
+        continue;
+      }
+      int64_t ns = (n - 63) * 1000;
+      if(ns > max_sleep_ns)
+      {
+        ns = max_sleep_ns;
+      }
+      std::this_thread::sleep_for(std::chrono::nanoseconds(ns));
+      slept += ns;
+    }
+#endif
+  }
+  //! Wakes all threads blocked in `futex_wait()` on `addr`.
+  inline void futex_wake_all(std::atomic<uint32_t> *addr) noexcept
+  {
+#ifdef __linux__
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t *>(addr), FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);
+#else
+    (void) addr;
+#endif
+  }
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <class R> basic_result_slot. Potential doc page: `basic_result_slot<R>`
+*/
+/* A one-shot slot into which one thread publishes a result, `R` being any
+`basic_result`, and any number of threads wait for and then read it. Unlike
+`std::promise<R>` there is no allocation nor mutex: it is one 32 bit atomic
+word next to the result, which is the futex waited upon. Embed it wherever it
+is convenient, or use `basic_shared_result<R>` for shared ownership.
+
+The result's own status bits are not atomic, so cannot be the publication
+word, which is why there is one more.
+*/
+template <class R> class OUTCOME_SYMBOL_VISIBLE basic_result_slot
+{
+  static_assert(is_basic_result_v<R>, "R must be a basic_result");
+
+  enum : uint32_t
+  {
+    _empty = 0,
+    _writing = 1,
+    _ready = 2,
+    _state_mask = 3,
+    _have_waiters = 4
+  };
+
+  std::atomic<uint32_t> _state{_empty};
+  union {
+    detail::empty_type _empty_result;
+    R _result;
+  };
+
+  template <class... Args> bool _set(Args &&... args)
+  {
+    // Waiters may have set their bit before anything was published
+    uint32_t v = _state.load(std::memory_order_relaxed);
+    do
+    {
+      if((v & _state_mask) != _empty)
+      {
+        return false;
+      }
+    } while(!_state.compare_exchange_weak(v, (v & ~_state_mask) | _writing, std::memory_order_acquire, std::memory_order_relaxed));
+#ifdef __cpp_exceptions
+    try
+    {
+      new(&_result) R(static_cast<Args &&>(args)...);  // NOLINT
+    }
+    catch(...)
+    {
+      // Leave it empty, so it can be set again
+      if(_state.exchange(_empty, std::memory_order_release) & _have_waiters)
+      {
+        detail::futex_wake_all(&_state);
+      }
+      throw;
+    }
+#else
+    new(&_result) R(static_cast<Args &&>(args)...);  // NOLINT
+#endif
+    if(_state.exchange(_ready, std::memory_order_release) & _have_waiters)
+    {
+      detail::futex_wake_all(&_state);
+    }
+    return true;
+  }
+  // Returns true if ready before `deadline`, or ever if `deadline` is null
+  bool _wait(const std::chrono::steady_clock::time_point *deadline) noexcept
+  {
+    uint32_t v = _state.load(std::memory_order_acquire);
+    while((v & _state_mask) != _ready)
+    {
+      if(!(v & _have_waiters))
+      {
+        if(!_state.compare_exchange_weak(v, v | _have_waiters, std::memory_order_acquire, std::memory_order_acquire))
+        {
+          continue;
+        }
+        v |= _have_waiters;
+      }
+      int64_t timeout_ns = -1;
+      if(deadline != nullptr)
+      {
+        timeout_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(*deadline - std::chrono::steady_clock::now()).count();
+        if(timeout_ns <= 0)
+        {
+          return false;
+        }
+      }
+      detail::futex_wait(&_state, v, timeout_ns);
+      v = _state.load(std::memory_order_acquire);
+    }
+    return true;
+  }
+
+public:
+  //! The result type.
+  using result_type = R;
+  //! The value type of the result.
+  using value_type = typename R::value_type;
+  //! The error type of the result.
+  using error_type = typename R::error_type;
+
+  //! Constructs an empty slot.
+  constexpr basic_result_slot() noexcept
+      : _empty_result()
+  {
+  }
+  basic_result_slot(const basic_result_slot &) = delete;
+  basic_result_slot(basic_result_slot &&) = delete;
+  basic_result_slot &operator=(const basic_result_slot &) = delete;
+  basic_result_slot &operator=(basic_result_slot &&) = delete;
+  ~basic_result_slot()
+  {
+    if((_state.load(std::memory_order_acquire) & _state_mask) == _ready)
+    {
+      _result.~R();
+    }
+  }
+
+  //! Publishes a result constructed from `v`. Returns false if one was already published.
+  OUTCOME_TEMPLATE(class U)
+  OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_constructible<R, U>::value))
+  bool set(U &&v) { return _set(static_cast<U &&>(v)); }
+  //! Publishes a successful result with the value constructed from `args`. Returns false if one was already published.
+  template <class... Args> bool set_value(Args &&... args) { return _set(in_place_type<typename R::value_type_if_enabled>, static_cast<Args &&>(args)...); }
+  //! Publishes a failed result with the error constructed from `args`. Returns false if one was already published.
+  template <class... Args> bool set_error(Args &&... args) { return _set(in_place_type<typename R::error_type_if_enabled>, static_cast<Args &&>(args)...); }
+
+  //! True if a result has been published.
+  bool ready() const noexcept { return (_state.load(std::memory_order_acquire) & _state_mask) == _ready; }
+  //! The published result, or null if none yet.
+  R *try_get() noexcept { return ready() ? &_result : nullptr; }
+  //! \overload
+  const R *try_get() const noexcept { return ready() ? &_result : nullptr; }
+  //! Blocks until a result is published, and returns it.
+  R &wait() noexcept
+  {
+    _wait(nullptr);
+    return _result;
+  }
+  //! Blocks until a result is published or `d` elapses, returning the result or null.
+  template <class Rep, class Period> R *wait_for(const std::chrono::duration<Rep, Period> &d) noexcept
+  {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(d);
+    return _wait(&deadline) ? &_result : nullptr;
+  }
+  //! Blocks until a result is published or `deadline` passes, returning the result or null.
+  template <class Duration> R *wait_until(const std::chrono::time_point<std::chrono::steady_clock, Duration> &deadline) noexcept
+  {
+    const std::chrono::steady_clock::time_point d = std::chrono::time_point_cast<std::chrono::steady_clock::duration>(deadline);
+    return _wait(&d) ? &_result : nullptr;
+  }
+};
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <class R> basic_shared_result. Potential doc page: `basic_shared_result<R>`
+*/
+/* A reference counted handle to a heap allocated `basic_result_slot<R>`, for when
+the producer and consumers have no common owner to embed the slot in. Copies
+share the one slot, so give one to the producer and keep one. One allocation,
+made on construction.
+*/
+template <class R> class OUTCOME_SYMBOL_VISIBLE basic_shared_result
+{
+  struct _node
+  {
+    std::atomic<size_t> _refcount{1};
+    basic_result_slot<R> _slot;
+  };
+  _node *_n;
+
+  void _release() noexcept
+  {
+    if(_n != nullptr && _n->_refcount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+      delete _n;
+    }
+    _n = nullptr;
+  }
+
+public:
+  //! The slot type.
+  using slot_type = basic_result_slot<R>;
+  //! The result type.
+  using result_type = R;
+
+  //! Allocates a new empty slot.
+  basic_shared_result()
+      : _n(new _node)
+  {
+  }
+  basic_shared_result(const basic_shared_result &o) noexcept
+      : _n(o._n)
+  {
+    if(_n != nullptr)
+    {
+      _n->_refcount.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  basic_shared_result(basic_shared_result &&o) noexcept
+      : _n(o._n)
+  {
+    o._n = nullptr;
+  }
+  basic_shared_result &operator=(const basic_shared_result &o) noexcept
+  {
+    _node *n = o._n;  // o may be *this
+    if(n != nullptr)
+    {
+      n->_refcount.fetch_add(1, std::memory_order_relaxed);
+    }
+    _release();
+    _n = n;
+    return *this;
+  }
+  basic_shared_result &operator=(basic_shared_result &&o) noexcept
+  {
+    if(this != &o)
+    {
+      _release();
+      _n = o._n;
+      o._n = nullptr;
+    }
+    return *this;
+  }
+  ~basic_shared_result() { _release(); }
+
+  //! True unless moved from.
+  explicit operator bool() const noexcept { return _n != nullptr; }
+  //! The shared slot.
+  slot_type &operator*() const noexcept { return _n->_slot; }
+  //! \overload
+  slot_type *operator->() const noexcept { return &_n->_slot; }
+};
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type alias template <class T, class EC = std::error_code> result_slot. Potential doc page: `basic_result_slot<R>`
+*/
+template <class T, class EC = std::error_code> using result_slot = basic_result_slot<result<T, EC>>;
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type alias template <class T, class EC = std::error_code> shared_result. Potential doc page: `basic_shared_result<R>`
+*/
+template <class T, class EC = std::error_code> using shared_result = basic_shared_result<result<T, EC>>;
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
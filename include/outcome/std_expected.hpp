@@ -0,0 +1,117 @@
+/* Interoperation with std::expected
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_STD_EXPECTED_HPP
+#define OUTCOME_STD_EXPECTED_HPP
+
+#include "basic_result.hpp"
+#include "try.hpp"
+
+#ifdef __cpp_lib_expected
+#define OUTCOME_FOUND_EXPECTED_HEADER 1
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace convert
+{
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+type definition  value_or_error<basic_result<R, S, NoValuePolicy>, std::expected<T, E>>. Potential doc page: NOT FOUND
+*/
+  /* Makes the explicit construction of a `basic_result` from a `std::expected`
+  move or copy only the member which is present. The generic `ValueOrError`
+  conversion would check `has_value()` twice, and can throw from `value()`.
+  */
+  template <class R, class S, class NoValuePolicy, class T, class E> struct value_or_error<basic_result<R, S, NoValuePolicy>, std::expected<T, E>>
+  {
+    static constexpr bool enable_result_inputs = false;
+    static constexpr bool enable_outcome_inputs = false;
+    OUTCOME_TEMPLATE(class X)
+    OUTCOME_TREQUIRES(OUTCOME_TPRED(std::is_same<std::expected<T, E>, std::decay_t<X>>::value                                                                                                   //
+                                    && ((std::is_void<R>::value && std::is_void<T>::value) || (!std::is_void<T>::value && std::is_constructible<R, decltype(*std::declval<X>())>::value))  //
+                                    && std::is_constructible<S, decltype(std::declval<X>().error())>::value))
+    constexpr basic_result<R, S, NoValuePolicy> operator()(X &&v) const
+    {
+      using type = basic_result<R, S, NoValuePolicy>;
+      if(!v.has_value())
+      {
+        return type{in_place_type<typename type::error_type>, static_cast<X &&>(v).error()};
+      }
+      if constexpr(std::is_void<T>::value)
+      {
+        return type{in_place_type<typename type::value_type>};
+      }
+      else
+      {
+        return type{in_place_type<typename type::value_type>, *static_cast<X &&>(v)};
+      }
+    }
+  };
+}  // namespace convert
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+/* Converts a `basic_result` into a `std::expected`, moving or copying only the
+member which is present. The reverse is the explicit converting constructor
+of `basic_result`.
+*/
+template <class R, class S, class NoValuePolicy> constexpr inline std::expected<R, S> to_expected(basic_result<R, S, NoValuePolicy> &&r)
+{
+  if(!r.has_value())
+  {
+    return std::expected<R, S>(std::unexpect, static_cast<basic_result<R, S, NoValuePolicy> &&>(r).assume_error());
+  }
+  if constexpr(std::is_void<R>::value)
+  {
+    return std::expected<R, S>();
+  }
+  else
+  {
+    return std::expected<R, S>(std::in_place, static_cast<basic_result<R, S, NoValuePolicy> &&>(r).assume_value());
+  }
+}
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class R, class S, class NoValuePolicy> constexpr inline std::expected<R, S> to_expected(const basic_result<R, S, NoValuePolicy> &r)
+{
+  if(!r.has_value())
+  {
+    return std::expected<R, S>(std::unexpect, r.assume_error());
+  }
+  if constexpr(std::is_void<R>::value)
+  {
+    return std::expected<R, S>();
+  }
+  else
+  {
+    return std::expected<R, S>(std::in_place, r.assume_value());
+  }
+}
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
+
+#endif
@@ -27,7 +27,9 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include "config.hpp"
 
-OUTCOME_V2_NAMESPACE_BEGIN
+#include <tuple>
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 /*! AWAITING HUGO JSON CONVERSION TOOL
 type definition template <class T> success_type. Potential doc page: `success_type<T>`
@@ -77,18 +79,218 @@ template <class T> inline constexpr success_type<std::decay_t<T>> success(T &&v)
   return success_type<std::decay_t<T>>{static_cast<T &&>(v)};
 }
 
+namespace detail
+{
+  /* Storage for a failure_type with both an error and an exception, where only
+  those present are constructed, and which are present is kept in one byte.
+  So `as_failure()` of an errored outcome neither constructs nor destroys an
+  exception_ptr.
+  */
+  struct failure_type_empty
+  {
+  };
+  enum class failure_type_state : unsigned char
+  {
+    none = 0,
+    have_error = (1U << 0U),
+    have_exception = (1U << 1U),
+    have_error_exception = (1U << 0U) | (1U << 1U)
+  };
+  struct failure_type_error_tag
+  {
+  };
+  struct failure_type_exception_tag
+  {
+  };
+  struct failure_type_error_exception_tag
+  {
+  };
+
+  // Used if both EC and E are trivially copyable
+  template <class EC, class E> struct failure_type_storage_trivial
+  {
+    union {
+      failure_type_empty _no_error;
+      EC _error;
+    };
+    union {
+      failure_type_empty _no_exception;
+      E _exception;
+    };
+    failure_type_state _state;
+
+    constexpr failure_type_storage_trivial() noexcept
+        : _no_error()
+        , _no_exception()
+        , _state(failure_type_state::none)
+    {
+    }
+    template <class U>
+    constexpr failure_type_storage_trivial(failure_type_error_tag /*unused*/, U &&u)
+        : _error(static_cast<U &&>(u))
+        , _no_exception()
+        , _state(failure_type_state::have_error)
+    {
+    }
+    template <class V>
+    constexpr failure_type_storage_trivial(failure_type_exception_tag /*unused*/, V &&v)
+        : _no_error()
+        , _exception(static_cast<V &&>(v))
+        , _state(failure_type_state::have_exception)
+    {
+    }
+    template <class U, class V>
+    constexpr failure_type_storage_trivial(failure_type_error_exception_tag /*unused*/, U &&u, V &&v)
+        : _error(static_cast<U &&>(u))
+        , _exception(static_cast<V &&>(v))
+        , _state(failure_type_state::have_error_exception)
+    {
+    }
+  };
+  // Used otherwise
+  template <class EC, class E> struct failure_type_storage_nontrivial
+  {
+    union {
+      failure_type_empty _no_error;
+      EC _error;
+    };
+    union {
+      failure_type_empty _no_exception;
+      E _exception;
+    };
+    failure_type_state _state;
+
+    constexpr bool _have_error() const noexcept { return (static_cast<unsigned>(_state) & static_cast<unsigned>(failure_type_state::have_error)) != 0; }
+    constexpr bool _have_exception() const noexcept { return (static_cast<unsigned>(_state) & static_cast<unsigned>(failure_type_state::have_exception)) != 0; }
+    void _set_have(failure_type_state which, bool v) noexcept
+    {
+      _state = static_cast<failure_type_state>(v ? (static_cast<unsigned>(_state) | static_cast<unsigned>(which)) : (static_cast<unsigned>(_state) & ~static_cast<unsigned>(which)));
+    }
+
+    constexpr failure_type_storage_nontrivial() noexcept
+        : _no_error()
+        , _no_exception()
+        , _state(failure_type_state::none)
+    {
+    }
+    template <class U>
+    constexpr failure_type_storage_nontrivial(failure_type_error_tag /*unused*/, U &&u)
+        : _error(static_cast<U &&>(u))
+        , _no_exception()
+        , _state(failure_type_state::have_error)
+    {
+    }
+    template <class V>
+    constexpr failure_type_storage_nontrivial(failure_type_exception_tag /*unused*/, V &&v)
+        : _no_error()
+        , _exception(static_cast<V &&>(v))
+        , _state(failure_type_state::have_exception)
+    {
+    }
+    template <class U, class V>
+    constexpr failure_type_storage_nontrivial(failure_type_error_exception_tag /*unused*/, U &&u, V &&v)
+        : _error(static_cast<U &&>(u))
+        , _exception(static_cast<V &&>(v))
+        , _state(failure_type_state::have_error_exception)
+    {
+    }
+    failure_type_storage_nontrivial(const failure_type_storage_nontrivial &o)
+        : _no_error()
+        , _no_exception()
+        , _state(failure_type_state::none)
+    {
+      if(o._have_error())
+      {
+        new(&_error) EC(o._error);  // NOLINT
+        _set_have(failure_type_state::have_error, true);
+      }
+      if(o._have_exception())
+      {
+        new(&_exception) E(o._exception);  // NOLINT
+        _set_have(failure_type_state::have_exception, true);
+      }
+    }
+    failure_type_storage_nontrivial(failure_type_storage_nontrivial &&o) noexcept(std::is_nothrow_move_constructible<EC>::value &&std::is_nothrow_move_constructible<E>::value)  // NOLINT
+        : _no_error()
+        , _no_exception()
+        , _state(failure_type_state::none)
+    {
+      if(o._have_error())
+      {
+        new(&_error) EC(static_cast<EC &&>(o._error));  // NOLINT
+        _set_have(failure_type_state::have_error, true);
+      }
+      if(o._have_exception())
+      {
+        new(&_exception) E(static_cast<E &&>(o._exception));  // NOLINT
+        _set_have(failure_type_state::have_exception, true);
+      }
+    }
+    failure_type_storage_nontrivial &operator=(const failure_type_storage_nontrivial &o)
+    {
+      if(this != &o)
+      {
+        _assign(_error, o._error, failure_type_state::have_error, o._have_error());
+        _assign(_exception, o._exception, failure_type_state::have_exception, o._have_exception());
+      }
+      return *this;
+    }
+    failure_type_storage_nontrivial &operator=(failure_type_storage_nontrivial &&o) noexcept(std::is_nothrow_move_constructible<EC>::value &&std::is_nothrow_move_assignable<EC>::value &&std::is_nothrow_move_constructible<E>::value &&std::is_nothrow_move_assignable<E>::value)  // NOLINT
+    {
+      if(this != &o)
+      {
+        _assign(_error, static_cast<EC &&>(o._error), failure_type_state::have_error, o._have_error());
+        _assign(_exception, static_cast<E &&>(o._exception), failure_type_state::have_exception, o._have_exception());
+      }
+      return *this;
+    }
+    ~failure_type_storage_nontrivial()
+    {
+      if(_have_error())
+      {
+        _error.~EC();
+      }
+      if(_have_exception())
+      {
+        _exception.~E();
+      }
+    }
+
+  private:
+    // Assigns, constructs or destroys a member of this from the same member of another, depending on which are present
+    template <class T, class U> void _assign(T &mine, U &&theirs, failure_type_state which, bool have_theirs)
+    {
+      const bool have_mine = (static_cast<unsigned>(_state) & static_cast<unsigned>(which)) != 0;
+      if(have_mine && have_theirs)
+      {
+        mine = static_cast<U &&>(theirs);
+      }
+      else if(have_mine)
+      {
+        mine.~T();
+        _set_have(which, false);
+      }
+      else if(have_theirs)
+      {
+        new(&mine) T(static_cast<U &&>(theirs));  // NOLINT
+        _set_have(which, true);
+      }
+    }
+  };
+  template <class EC, class E>
+  using failure_type_storage_select = std::conditional_t<OUTCOME_IS_TRIVIALLY_COPYABLE(EC) && OUTCOME_IS_TRIVIALLY_COPYABLE(E), failure_type_storage_trivial<EC, E>, failure_type_storage_nontrivial<EC, E>>;
+}  // namespace detail
+
 /*! AWAITING HUGO JSON CONVERSION TOOL
 type definition template <class EC, class E = void> failure_type. Potential doc page: `failure_type<EC, EP = void>`
 */
-template <class EC, class E = void> struct OUTCOME_NODISCARD failure_type
+template <class EC, class E = void> struct OUTCOME_NODISCARD failure_type : private detail::failure_type_storage_select<EC, E>
 {
   using error_type = EC;
   using exception_type = E;
 
 private:
-  bool _have_error{}, _have_exception{};
-  error_type _error;
-  exception_type _exception;
+  using _base = detail::failure_type_storage_select<EC, E>;
 
   struct error_init_tag
   {
@@ -106,39 +308,36 @@ public:
   ~failure_type() = default;
   template <class U, class V>
   constexpr explicit failure_type(U &&u, V &&v)
-      : _have_error(true)
-      , _have_exception(true)
-      , _error(static_cast<U &&>(u))
-      , _exception(static_cast<V &&>(v))
+      : _base(detail::failure_type_error_exception_tag(), static_cast<U &&>(u), static_cast<V &&>(v))
   {
   }
   template <class U>
   constexpr explicit failure_type(in_place_type_t<error_type> /*unused*/, U &&u, error_init_tag /*unused*/ = error_init_tag())
-      : _have_error(true)
-      , _error(static_cast<U &&>(u))
-      , _exception()
+      : _base(detail::failure_type_error_tag(), static_cast<U &&>(u))
   {
   }
   template <class U>
   constexpr explicit failure_type(in_place_type_t<exception_type> /*unused*/, U &&u, exception_init_tag /*unused*/ = exception_init_tag())
-      : _have_exception(true)
-      , _error()
-      , _exception(static_cast<U &&>(u))
+      : _base(detail::failure_type_exception_tag(), static_cast<U &&>(u))
   {
   }
 
-  constexpr bool has_error() const { return _have_error; }
-  constexpr bool has_exception() const { return _have_exception; }
+  constexpr bool has_error() const noexcept { return (static_cast<unsigned>(this->_state) & static_cast<unsigned>(detail::failure_type_state::have_error)) != 0; }
+  constexpr bool has_exception() const noexcept { return (static_cast<unsigned>(this->_state) & static_cast<unsigned>(detail::failure_type_state::have_exception)) != 0; }
 
-  constexpr error_type &error() & { return _error; }
-  constexpr const error_type &error() const & { return _error; }
-  constexpr error_type &&error() && { return static_cast<error_type &&>(_error); }
-  constexpr const error_type &&error() const && { return static_cast<error_type &&>(_error); }
+  //! Requires `has_error()`, as an absent error is not constructed.
+  constexpr error_type &error() & { return this->_error; }
+  constexpr const error_type &error() const & { return this->_error; }
+  //! Moves out the error, or returns a default constructed error if `!has_error()`.
+  constexpr error_type error() && { return has_error() ? error_type(static_cast<error_type &&>(this->_error)) : error_type(); }
+  constexpr error_type error() const && { return has_error() ? error_type(this->_error) : error_type(); }
 
-  constexpr exception_type &exception() & { return _exception; }
-  constexpr const exception_type &exception() const & { return _exception; }
-  constexpr exception_type &&exception() && { return static_cast<exception_type &&>(_exception); }
-  constexpr const exception_type &&exception() const && { return static_cast<exception_type &&>(_exception); }
+  //! Requires `has_exception()`, as an absent exception is not constructed.
+  constexpr exception_type &exception() & { return this->_exception; }
+  constexpr const exception_type &exception() const & { return this->_exception; }
+  //! Moves out the exception, or returns a default constructed exception if `!has_exception()`.
+  constexpr exception_type exception() && { return has_exception() ? exception_type(static_cast<exception_type &&>(this->_exception)) : exception_type(); }
+  constexpr exception_type exception() const && { return has_exception() ? exception_type(this->_exception) : exception_type(); }
 };
 template <class EC> struct OUTCOME_NODISCARD failure_type<EC, void>
 {
@@ -209,6 +408,72 @@ template <class EC, class E> inline constexpr failure_type<std::decay_t<EC>, std
   return failure_type<std::decay_t<EC>, std::decay_t<E>>{static_cast<EC &&>(v), static_cast<E &&>(w)};
 }
 
+namespace detail
+{
+  // The arguments forwarded by success_ref() and failure_ref(), held by reference until consumed
+  template <class... Args> struct forwarded_args
+  {
+    std::tuple<Args &&...> _args;
+
+    constexpr explicit forwarded_args(std::tuple<Args &&...> &&args) noexcept
+        : _args(static_cast<std::tuple<Args &&...> &&>(args))
+    {
+    }
+    forwarded_args(const forwarded_args &) = delete;
+    forwarded_args(forwarded_args &&) = default;  // NOLINT
+    forwarded_args &operator=(const forwarded_args &) = delete;
+    forwarded_args &operator=(forwarded_args &&) = delete;
+    ~forwarded_args() = default;
+  };
+  // Selects the private constructors unpacking forwarded_args, which nothing else can name
+  struct forwarded_args_tag
+  {
+  };
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <class... Args> success_ref_type. Potential doc page: `success_ref_type<Args...>`
+*/
+/* Like success_type, but holds references to the arguments with which to
+construct the value, rather than the value. A `basic_result` or
+`basic_outcome` constructed from it constructs its value in place from them,
+so there is no intermediate copy or move, and the value need not be movable.
+As it holds references, it must be consumed within the full expression
+creating it, usually a `return success_ref(...);`.
+*/
+template <class... Args> struct OUTCOME_NODISCARD success_ref_type : detail::forwarded_args<Args...>
+{
+  using detail::forwarded_args<Args...>::forwarded_args;
+
+  //! The arguments with which to construct the value.
+  constexpr std::tuple<Args &&...> &args() noexcept { return this->_args; }
+};
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <class... Args> failure_ref_type. Potential doc page: `failure_ref_type<Args...>`
+*/
+//! Like success_ref_type, but for constructing the error in place.
+template <class... Args> struct OUTCOME_NODISCARD failure_ref_type : detail::forwarded_args<Args...>
+{
+  using detail::forwarded_args<Args...>::forwarded_args;
+
+  //! The arguments with which to construct the error.
+  constexpr std::tuple<Args &&...> &args() noexcept { return this->_args; }
+};
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class... Args> inline constexpr success_ref_type<Args...> success_ref(Args &&... args) noexcept
+{
+  return success_ref_type<Args...>{std::forward_as_tuple(static_cast<Args &&>(args)...)};
+}
+/*! AWAITING HUGO JSON CONVERSION TOOL
+SIGNATURE NOT RECOGNISED
+*/
+template <class... Args> inline constexpr failure_ref_type<Args...> failure_ref(Args &&... args) noexcept
+{
+  return failure_ref_type<Args...>{std::forward_as_tuple(static_cast<Args &&>(args)...)};
+}
+
 namespace detail
 {
   template <class T> struct is_success_type
@@ -232,12 +497,12 @@ namespace detail
 /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
-template <class T> static constexpr bool is_success_type = detail::is_success_type<std::decay_t<T>>::value;
+template <class T> OUTCOME_INLINE_VARIABLE constexpr bool is_success_type = detail::is_success_type<std::decay_t<T>>::value;
 
 /*! AWAITING HUGO JSON CONVERSION TOOL
 SIGNATURE NOT RECOGNISED
 */
-template <class T> static constexpr bool is_failure_type = detail::is_failure_type<std::decay_t<T>>::value;
+template <class T> OUTCOME_INLINE_VARIABLE constexpr bool is_failure_type = detail::is_failure_type<std::decay_t<T>>::value;
 
 OUTCOME_V2_NAMESPACE_END
 
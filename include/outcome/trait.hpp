@@ -27,7 +27,14 @@ Distributed under the Boost Software License, Version 1.0.
 
 #include "config.hpp"
 
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  // std::is_destructible costs several class instantiations per type, this costs one function template
+  template <class T, class = decltype(static_cast<T *>(nullptr)->~T())> constexpr inline bool is_destructible(int /*unused*/) { return true; }
+  template <class T> constexpr inline bool is_destructible(...) { return false; }
+}  // namespace detail
 
 namespace trait
 {
@@ -35,14 +42,14 @@ namespace trait
 SIGNATURE NOT RECOGNISED
 */
   template <class R>                                                             //
-  static constexpr bool type_can_be_used_in_basic_result =                       //
+  OUTCOME_INLINE_VARIABLE constexpr bool type_can_be_used_in_basic_result =      //
   (!std::is_reference<R>::value                                                  //
    && !OUTCOME_V2_NAMESPACE::detail::is_in_place_type_t<std::decay_t<R>>::value  //
    && !is_success_type<R>                                                        //
    && !is_failure_type<R>                                                        //
    && !std::is_array<R>::value                                                   //
    && (std::is_void<R>::value || (std::is_object<R>::value                       //
-                                  && std::is_destructible<R>::value))            //
+                                  && detail::is_destructible<R>(0)))             //
   );
 
   /*! AWAITING HUGO JSON CONVERSION TOOL
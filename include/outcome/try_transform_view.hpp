@@ -0,0 +1,244 @@
+/* A lazy range adaptor stopping at the first failure
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef OUTCOME_TRY_TRANSFORM_VIEW_HPP
+#define OUTCOME_TRY_TRANSFORM_VIEW_HPP
+
+#include "collect.hpp"
+
+#if(__cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)) && __has_include(<ranges>)
+#include <functional>
+#include <optional>
+#include <ranges>
+#endif
+
+#ifdef __cpp_lib_ranges
+#define OUTCOME_FOUND_RANGES_HEADER 1
+
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
+
+namespace detail
+{
+  // A callable made move assignable, as lambdas are not, and views must be
+  template <class F> class try_transform_box
+  {
+    std::optional<F> _f;
+
+  public:
+    constexpr explicit try_transform_box(F f) noexcept(std::is_nothrow_move_constructible_v<F>)
+        : _f(std::in_place, static_cast<F &&>(f))
+    {
+    }
+    try_transform_box(const try_transform_box &) = delete;
+    try_transform_box(try_transform_box &&) = default;
+    try_transform_box &operator=(const try_transform_box &) = delete;
+    constexpr try_transform_box &operator=(try_transform_box &&o) noexcept(std::is_nothrow_move_constructible_v<F>)
+    {
+      if(this != &o)
+      {
+        _f.reset();
+        if(o._f)
+        {
+          _f.emplace(static_cast<F &&>(*o._f));
+        }
+      }
+      return *this;
+    }
+    ~try_transform_box() = default;
+    constexpr F &operator*() noexcept { return *_f; }
+  };
+}  // namespace detail
+
+/*! AWAITING HUGO JSON CONVERSION TOOL
+type definition template <class V, class F> try_transform_view. Potential doc page: `views::try_transform`
+*/
+/* A single pass view of the values of the `basic_result` or `basic_outcome`
+returned by calling `F` on each element of `V`, ending early at the first
+failure, which is then available from `status()`. Each element is computed
+when the iterator reaches it, and its value is held in the view until the
+iterator moves on, so nothing is allocated however long the input.
+
+Like `std::ranges::istream_view`, the iteration state lives in the view, so
+it is an input range whichever `V` is, `begin()` may be called only once, and
+the view must not be moved while being iterated. Keep it in a variable to
+check `status()` afterwards.
+*/
+template <std::ranges::input_range V, class F>
+requires std::ranges::view<V> && std::is_object_v<F> && std::invocable<F &, std::ranges::range_reference_t<V>>
+class try_transform_view : public std::ranges::view_interface<try_transform_view<V, F>>
+{
+  using _result_type = std::remove_cvref_t<std::invoke_result_t<F &, std::ranges::range_reference_t<V>>>;
+
+public:
+  //! The type of the values yielded.
+  using value_type = typename _result_type::value_type;
+  //! The type of the failure which ended the iteration.
+  using failure_type = decltype(std::declval<_result_type &&>().as_failure());
+  //! The type returned by `status()`.
+  using status_type = detail::collect_rebind_t<_result_type, void>;
+  static_assert(std::is_object_v<value_type>, "try_transform_view requires results of object values");
+
+private:
+  V _base;
+  detail::try_transform_box<F> _f;
+  std::optional<std::ranges::iterator_t<V>> _current;
+  std::optional<value_type> _value;
+  std::optional<failure_type> _failure;
+
+  constexpr void _fetch()
+  {
+    if(*_current == std::ranges::end(_base))
+    {
+      _value.reset();
+      return;
+    }
+    _result_type r = std::invoke(*_f, **_current);
+    if(r.has_value())
+    {
+      _value.emplace(static_cast<_result_type &&>(r).assume_value());
+    }
+    else
+    {
+      _value.reset();
+      _failure.emplace(static_cast<_result_type &&>(r).as_failure());
+    }
+  }
+
+public:
+  class iterator
+  {
+    friend class try_transform_view;
+    try_transform_view *_parent{nullptr};
+
+    constexpr explicit iterator(try_transform_view *parent) noexcept
+        : _parent(parent)
+    {
+    }
+    constexpr bool _done() const noexcept { return !_parent->_value.has_value(); }
+
+  public:
+    using iterator_concept = std::input_iterator_tag;
+    using value_type = typename try_transform_view::value_type;
+    using difference_type = std::ptrdiff_t;
+
+    iterator() = default;
+    iterator(const iterator &) = delete;
+    iterator(iterator &&) = default;
+    iterator &operator=(const iterator &) = delete;
+    iterator &operator=(iterator &&) = default;
+    ~iterator() = default;
+
+    constexpr value_type &operator*() const noexcept { return *_parent->_value; }
+    constexpr iterator &operator++()
+    {
+      ++*_parent->_current;
+      _parent->_fetch();
+      return *this;
+    }
+    constexpr void operator++(int) { ++*this; }
+    friend constexpr bool operator==(const iterator &i, std::default_sentinel_t /*unused*/) noexcept { return i._done(); }
+  };
+
+  //! Constructs the view over `base`, calling `f` on each element.
+  constexpr try_transform_view(V base, F f)
+      : _base(static_cast<V &&>(base))
+      , _f(static_cast<F &&>(f))
+  {
+  }
+  try_transform_view(const try_transform_view &) = delete;
+  try_transform_view(try_transform_view &&) = default;
+  try_transform_view &operator=(const try_transform_view &) = delete;
+  try_transform_view &operator=(try_transform_view &&) = default;
+  ~try_transform_view() = default;
+
+  //! The underlying view.
+  constexpr const V &base() const & noexcept { return _base; }
+  //! \overload
+  constexpr V base() && { return static_cast<V &&>(_base); }
+
+  //! Begins the single pass, computing the first element.
+  constexpr iterator begin()
+  {
+    _current.emplace(std::ranges::begin(_base));
+    _failure.reset();
+    _fetch();
+    return iterator(this);
+  }
+  //! The end of the single pass.
+  constexpr std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+  //! True if the pass ended at a failure.
+  constexpr bool failed() const noexcept { return _failure.has_value(); }
+  //! Success, or the failure at which the pass ended.
+  constexpr status_type status() const &
+  {
+    if(_failure)
+    {
+      return *_failure;
+    }
+    return success();
+  }
+  //! \overload
+  constexpr status_type status() &&
+  {
+    if(_failure)
+    {
+      return static_cast<failure_type &&>(*_failure);
+    }
+    return success();
+  }
+};
+
+template <class R, class F> try_transform_view(R &&, F) -> try_transform_view<std::views::all_t<R>, F>;
+
+namespace detail
+{
+  template <class F> struct try_transform_closure
+  {
+    F f;
+    template <std::ranges::viewable_range R> friend constexpr auto operator|(R &&r, try_transform_closure c) { return try_transform_view(static_cast<R &&>(r), static_cast<F &&>(c.f)); }
+  };
+  struct try_transform_fn
+  {
+    template <std::ranges::viewable_range R, class F> constexpr auto operator()(R &&r, F &&f) const { return try_transform_view(static_cast<R &&>(r), static_cast<F &&>(f)); }
+    template <class F> constexpr auto operator()(F &&f) const { return try_transform_closure<std::decay_t<F>>{static_cast<F &&>(f)}; }
+  };
+}  // namespace detail
+
+namespace views
+{
+  /*! AWAITING HUGO JSON CONVERSION TOOL
+  SIGNATURE NOT RECOGNISED
+  */
+  /* `views::try_transform(r, f)` and `r | views::try_transform(f)` make a
+  `try_transform_view` of `r`.
+  */
+  inline constexpr detail::try_transform_fn try_transform{};
+}  // namespace views
+
+OUTCOME_V2_NAMESPACE_END
+
+#endif
+
+#endif
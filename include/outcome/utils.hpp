@@ -26,18 +26,28 @@ Distributed under the Boost Software License, Version 1.0.
 #define OUTCOME_UTILS_HPP
 
 #include "config.hpp"
+#include "errno_tables.hpp"
 
 #include <exception>
 #include <string>
 #include <system_error>
 
-OUTCOME_V2_NAMESPACE_BEGIN
+OUTCOME_V2_NAMESPACE_EXPORT_BEGIN
 
 #ifdef __cpp_exceptions
 /*! AWAITING HUGO JSON CONVERSION TOOL 
 SIGNATURE NOT RECOGNISED
 */
-inline std::error_code error_from_exception(std::exception_ptr &&ep = std::current_exception(), std::error_code not_matched = std::make_error_code(std::errc::resource_unavailable_try_again)) noexcept
+OUTCOME_HEADERS_ONLY_FUNC_SPEC std::error_code error_from_exception(std::exception_ptr &&ep = std::current_exception(), std::error_code not_matched = std::make_error_code(std::errc::resource_unavailable_try_again)) noexcept;
+
+/*! AWAITING HUGO JSON CONVERSION TOOL 
+SIGNATURE NOT RECOGNISED
+*/
+OUTCOME_HEADERS_ONLY_FUNC_SPEC void try_throw_std_exception_from_error(std::error_code ec, const std::string &msg = std::string{});
+
+// These are cold, so the compiled library keeps them out of line
+#if OUTCOME_HEADERS_ONLY_DEFINITIONS
+OUTCOME_HEADERS_ONLY_FUNC_SPEC std::error_code error_from_exception(std::exception_ptr &&ep, std::error_code not_matched) noexcept
 {
   if(!ep)
   {
@@ -103,36 +113,32 @@ inline std::error_code error_from_exception(std::exception_ptr &&ep = std::curre
   return not_matched;
 }
 
-/*! AWAITING HUGO JSON CONVERSION TOOL 
-SIGNATURE NOT RECOGNISED
-*/
-inline void try_throw_std_exception_from_error(std::error_code ec, const std::string &msg = std::string{})
+OUTCOME_HEADERS_ONLY_FUNC_SPEC void try_throw_std_exception_from_error(std::error_code ec, const std::string &msg)
 {
-  if(!ec || (ec.category() != std::generic_category()
-#ifndef _WIN32
-             && ec.category() != std::system_category()
-#endif
-             ))
+  if(!ec || !is_errno_category(ec.category()))
   {
     return;
   }
-  switch(ec.value())
+  switch(errno_exception_kind(ec.value()))
   {
-  case EINVAL:
+  case errno_exception::none:
+    break;
+  case errno_exception::invalid_argument:
     throw msg.empty() ? std::invalid_argument("invalid argument") : std::invalid_argument(msg);
-  case EDOM:
+  case errno_exception::domain_error:
     throw msg.empty() ? std::domain_error("domain error") : std::domain_error(msg);
-  case E2BIG:
+  case errno_exception::length_error:
     throw msg.empty() ? std::length_error("length error") : std::length_error(msg);
-  case ERANGE:
+  case errno_exception::out_of_range:
     throw msg.empty() ? std::out_of_range("out of range") : std::out_of_range(msg);
-  case EOVERFLOW:
+  case errno_exception::overflow_error:
     throw msg.empty() ? std::overflow_error("overflow error") : std::overflow_error(msg);
-  case ENOMEM:
+  case errno_exception::bad_alloc:
     throw std::bad_alloc();
   }
 }
 #endif
+#endif
 
 OUTCOME_V2_NAMESPACE_END
 
@@ -0,0 +1,54 @@
+/* The compiled part of Outcome
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+/* Outcome is header only, but this can be compiled into the outcome::compiled
+CMake target. Code linking that has OUTCOME_HEADERS_ONLY defined to 0, which
+makes the cold functions such as error_from_exception() declarations only,
+defined here, and declares `extern template` the common types in
+OUTCOME_EXTERN_TEMPLATE_TYPES, explicitly instantiated here. So each
+translation unit neither instantiates nor emits its own copy of them, which
+saves compile time, and duplicate weak symbols for the linker to discard.
+
+This must be compiled with the same OUTCOME_EXTERN_TEMPLATE_TYPES, and C++
+exceptions setting, as the code linking it.
+*/
+
+#define OUTCOME_HEADERS_ONLY 0
+#define OUTCOME_SOURCE 1
+
+#include "../include/outcome.hpp"
+#include "../include/outcome/utils.hpp"
+
+#define OUTCOME_INSTANTIATE_RESULT(R) OUTCOME_EXPLICIT_INSTANTIATE_RESULT(template, R)
+#define OUTCOME_INSTANTIATE_OUTCOME(R) OUTCOME_EXPLICIT_INSTANTIATE_OUTCOME(template, R)
+#define OUTCOME_INSTANTIATE_PRINT(R) OUTCOME_EXPLICIT_INSTANTIATE_PRINT(template, R)
+
+OUTCOME_V2_NAMESPACE_BEGIN
+
+template class bad_result_access_with<std::error_code>;
+OUTCOME_EXTERN_TEMPLATE_TYPES(OUTCOME_INSTANTIATE_RESULT)
+OUTCOME_EXTERN_TEMPLATE_TYPES(OUTCOME_INSTANTIATE_OUTCOME)
+OUTCOME_EXTERN_TEMPLATE_TYPES(OUTCOME_INSTANTIATE_PRINT)
+
+OUTCOME_V2_NAMESPACE_END
@@ -1,40 +1,54 @@
 #!/usr/bin/python3
 # File created by Tom Westerhout in May 2017
-
-import sys
+#
+# Compiles each canned codegen test sequence, counts the opcodes generated for
+# test1(), and fails if any exceeds its budget in budgets.json.
+#
+# Usage: compile_and_count.py [--compiler PATH] [--family gcc|clang|msvc]
+#                             [--output-dir DIR] [--tolerance PERCENT]
+#                             [--update-budgets] [sources...] [-- flags...]
+#
+# By default the compiler is $CXX, or the family's usual driver, and every
+# .cpp in this directory is tested. The sequences include the headers in
+# include/, so anything after -- is passed to every compile, at least the
+# include path for quickcpplib is needed. All outputs (binaries, disassembly,
+# the JUnit XML and CSV of counts) are written to the output directory, never
+# into the source tree.
+
+import argparse
+import json
 import os
 import subprocess
+import sys
 
 import count_opcodes
 
 
-def _mk_f(format_string : str):
-    return lambda s1, s2 : format_string.format(s1, s2)
-
-def _mk_o(initial_ext: str, final_ext : str):
-    return lambda s : s.replace("." + initial_ext, "." + final_ext)
+_here_ = os.path.dirname(os.path.abspath(__file__))
+_budgets_file_ = os.path.join(_here_, "budgets.json")
 
-
-
-_compilers_ = \
-    { "posix"   : ["gcc", "clang"]
-    , "nt"      : ["msvc"]  #, "msvc_clang"]
+_default_compiler_ = \
+    { "gcc"        : "g++"
+    , "clang"      : "clang++"
+    , "msvc"       : "cl"
+    , "msvc_clang" : "clang"
     }
 
+# (compile arguments after the compiler, extension of compiler output)
 _compile_info_ = \
-    { "gcc"        : (_mk_f("g++-9 -std=c++17 -DNDEBUG -O3 -fno-stack-protector -fno-exceptions {} -o {}"), _mk_o("cpp", "out"))
-    , "clang"      : (_mk_f("clang++-9 -std=c++17 -DNDEBUG -O3 -fno-exceptions {} -o {}"), _mk_o("cpp", "out"))
-    , "msvc"       : (_mk_f("cl /std:c++17 /c /EHsc /DNDEBUG /O2 /GS- /GR /Gy /Zc:inline /MT "
-                           + "/D_UNICODE=1 /DUNICODE=1 {} /Fo{}"), _mk_o("cpp", "obj"))
-    , "msvc_clang" : (_mk_f("clang -std=c++17 -c -DNDEBUG -O3 -fno-exceptions "
-                           + "-D_UNICODE=1 -DUNICODE=1 {} -o {} -fms-compatibility-version=19"), _mk_o("cpp", "out"))
+    { "gcc"        : (lambda src, out: ["-std=c++17", "-DNDEBUG", "-O3", "-fno-stack-protector", "-fno-exceptions", src, "-o", out], ".out")
+    , "clang"      : (lambda src, out: ["-std=c++17", "-DNDEBUG", "-O3", "-fno-exceptions", src, "-o", out], ".out")
+    , "msvc"       : (lambda src, out: ["/nologo", "/std:c++17", "/c", "/EHsc", "/DNDEBUG", "/O2", "/GS-", "/GR", "/Gy", "/Zc:inline", "/MT",
+                                        "/D_UNICODE=1", "/DUNICODE=1", src, "/Fo" + out], ".obj")
+    , "msvc_clang" : (lambda src, out: ["-std=c++17", "-c", "-DNDEBUG", "-O3", "-fno-exceptions",
+                                        "-D_UNICODE=1", "-DUNICODE=1", src, "-o", out, "-fms-compatibility-version=19"], ".out")
     }
 
 _disassemble_info_ = \
-    { "gcc"        : (_mk_f("objdump -C -d {} > {}"), _mk_o("out", "gcc.S"))
-    , "clang"      : (_mk_f("objdump -C -d {} > {}"), _mk_o("out", "clang.S"))
-    , "msvc"       : (_mk_f("dumpbin /disasm {} > {}"), _mk_o("obj", "msvc.S"))
-    , "msvc_clang" : (_mk_f("dumpbin /disasm {} > {}"), _mk_o("out", "msvc_clang.S"))
+    { "gcc"        : lambda obj: ["objdump", "-C", "-d", obj]
+    , "clang"      : lambda obj: ["objdump", "-C", "-d", obj]
+    , "msvc"       : lambda obj: ["dumpbin", "/disasm", obj]
+    , "msvc_clang" : lambda obj: ["dumpbin", "/disasm", obj]
     }
 
 _function_ = \
@@ -44,135 +58,150 @@ _function_ = \
     , "msvc_clang" : ("test1", "test1")
     }
 
+
+def detect_family(compiler : str) -> str:
+    name = os.path.basename(compiler).lower()
+    if "clang" in name:
+        return "clang"
+    if name.startswith("cl") and not name.startswith("clang"):
+        return "msvc"
+    return "gcc"
+
+
 #
-# Contains upper bounds on number of ops in the format
+# Upper bounds on number of ops in the format
 #
-# { 'test1' : { 'gcc' : 10, 'clang' : 8, 'msvc' : 123, 'msvc_clang' : 20 }
-# , 'test2' : { ... }
+# { "test1" : { "gcc" : 10, "clang" : 8, "msvc" : 123 }
+# , "test2" : { ... }
 # , ...
 # }
 #
-limits = {
-"min_result_construct_value_move_destruct"     : { 'gcc' :  5, 'clang' :  5, 'msvc' :  5 },
-"min_result_next"                              : { 'gcc' :  5, 'clang' :  5, 'msvc' :  5 },
-}
+# A test or compiler family without a budget is measured and reported but
+# cannot fail. Budgets are the counts last measured, and a count fails only
+# if it exceeds its budget by more than the tolerance, so that point releases
+# of a compiler shuffling a few opcodes do not fail the suite.
+#
+def load_budgets() -> dict:
+    with open(_budgets_file_, "rt") as ih:
+        return json.load(ih)
 
 
+# The most opcodes allowed for a budget, being at least a few opcodes over it
+_min_slack_ = 2
 
 
+def allowed(limit : int, tolerance : float) -> int:
+    return limit + max(_min_slack_, int(limit * tolerance / 100.0 + 0.999))
 
-#
-# Tries to compiler src_file using compiler.
-# On success: returns name of the executable. 
-# On failure: returns None
-#
-def compile(src_file : str, compiler : str) -> str:
-    if src_file is None:
-        return None
-    print("[*] Compiling '" + src_file + "' with " + compiler + "...", 
-        file=sys.stderr)
 
-    command, output = _compile_info_[compiler]
-    try:
-        subprocess.check_output(command(src_file, output(src_file)), 
-            stderr=subprocess.STDOUT, shell=True)
-    except subprocess.CalledProcessError as e:
-        print("[-] Error while compiling: " + e.output.decode('utf-8'), 
-            file=sys.stderr)
-        return None
-    return output(src_file)
+def save_budgets(budgets : dict):
+    with open(_budgets_file_, "wt") as oh:
+        json.dump(budgets, oh, indent=2, sort_keys=True)
+        oh.write("\n")
+
 
 #
-# Tries to disassemble obj_file using a tool corresponding
-# to compiler. If disassembling suceeds, deletes the obj_file.
-# On success: returns name of the file with asm code. 
+# Compiles src_file, then disassembles it into the output directory.
+# On success: returns the name of the file with asm code.
 # On failure: returns None
 #
-def disassemble(obj_file : str, compiler : str) -> str:
-    if obj_file is None:
-        return None
-    print("[*] Disassembling '" + obj_file + "' with " + compiler + "...", 
-        file=sys.stderr)
-
-    command, output = _disassemble_info_[compiler]
+def compile_and_disassemble(src_file : str, compiler : str, family : str, outdir : str, flags : list) -> str:
+    test_name = os.path.splitext(os.path.basename(src_file))[0]
+    args, ext = _compile_info_[family]
+    obj_file = os.path.join(outdir, test_name + ext)
+    print("[*] Compiling '" + src_file + "' with " + compiler + "...", file=sys.stderr)
     try:
-        subprocess.check_output(command(obj_file, output(obj_file)), 
-            stderr=subprocess.STDOUT, shell=True)
-    except subprocess.CalledProcessError as e:
-        print("[-] Error while dissasembling: " + e.output.decode('utf-8'), 
-            file=sys.stderr)
+        subprocess.check_output([compiler] + flags + args(src_file, obj_file), stderr=subprocess.STDOUT)
+    except (subprocess.CalledProcessError, OSError) as e:
+        print("[-] Error while compiling: " + (e.output.decode('utf-8') if hasattr(e, 'output') else str(e)), file=sys.stderr)
         return None
 
+    asm_file = os.path.join(outdir, test_name + "." + family + ".S")
+    print("[*] Disassembling '" + obj_file + "'...", file=sys.stderr)
     try:
-        os.remove(obj_file)
-    except OSError as e:
-        print("[-] Error removing file: " + e.strerror)
+        with open(asm_file, "wt") as oh:
+            subprocess.check_call(_disassemble_info_[family](obj_file), stdout=oh)
+    except (subprocess.CalledProcessError, OSError) as e:
+        print("[-] Error while disassembling: " + str(e), file=sys.stderr)
         return None
-    return output(obj_file)
-
+    os.remove(obj_file)
+    return asm_file
 
-def test_single(outname : str, func : str, src_file : str, compiler : str, indent : int):
-    asm_file = disassemble(compile(src_file, compiler), compiler)
-    assert asm_file is not None 
 
-    test_name = src_file.replace(".cpp", "")
-    count, opcodes = count_opcodes.count_opcodes(outname, asm_file, func)
+#
+# Returns (test name, opcode count or -1, limit or None, junit xml fragment)
+#
+def test_single(src_file : str, compiler : str, family : str, outdir : str, budgets : dict, tolerance : float, flags : list):
+    test_name = os.path.splitext(os.path.basename(src_file))[0]
+    limit = budgets.get(test_name, {}).get(family)
+    xml_string = '  <testcase name="' + test_name + '.' + family + '">\n'
+
+    asm_file = compile_and_disassemble(src_file, compiler, family, outdir, flags)
+    count, opcodes = -1, None
+    if asm_file is not None:
+        func, outname = _function_[family]
+        count, opcodes = count_opcodes.count_opcodes(outname, asm_file, func)
     if count == -1:
-        print("[-] No call to " + func + " found.", file=sys.stderr)
-        sys.exit(1)
-    try:
-        os.remove(asm_file)
-    except OSError as e:
-        print("[-] Error removing file: " + e.strerror)
-    
-    output = "<![CDATA[\n" + "\n".join(opcodes) + "\n]]>"
-    xml_string = '  '*indent + '<testcase name="' + test_name + '.' + \
-        compiler + '">\n'
-    if test_name in limits and compiler in limits[test_name] and limits[test_name][compiler] < count:
-        xml_string += '  '*(indent+1) + '<failure message="Opcodes generated ' + \
-            str(count) + ' exceeds limit ' + str(limits[test_name][compiler]) + '"/>\n'
-    xml_string += '  '*(indent+2) + '<system-out>\n' + output + '\n' + \
-                  '  '*(indent+2) + '</system-out>\n' + \
-                  '  '*indent + '</testcase>\n'
-
-    return (test_name, count, xml_string)
+        message = "Failed to compile" if asm_file is None else "No function " + _function_[family][0] + " found"
+        print("[-] " + test_name + ": " + message, file=sys.stderr)
+        xml_string += '    <failure message="' + message + '"/>\n'
+    elif limit is not None and count > allowed(limit, tolerance):
+        print("[-] " + test_name + ": opcodes generated " + str(count) + " exceeds budget " + str(limit) + " plus tolerance", file=sys.stderr)
+        xml_string += '    <failure message="Opcodes generated ' + str(count) + ' exceeds budget ' + str(limit) + ' plus tolerance"/>\n'
+    else:
+        print("[+] " + test_name + ": " + str(count) + " opcodes (budget " + str(limit) + ")", file=sys.stderr)
+    if opcodes is not None:
+        xml_string += '    <system-out>\n<![CDATA[\n' + "\n".join(opcodes) + '\n]]>\n    </system-out>\n'
+    xml_string += '  </testcase>\n'
+    return test_name, count, limit, xml_string
 
 
 def list_src_files():
-    return sorted(filter(lambda src_file: os.path.isfile(src_file), 
-           filter(lambda s: s.endswith(".cpp"), 
-               os.listdir())))
-
-
-def test_all(func : dict):
-    xml_string = '<?xml version="1.0" encoding="UTF-8"?>\n' + \
-                 '<testsuite name="constexpr">\n'
-    # holds (compiler, name, count) tuples
-    csv_data = []
-    for src_file in list_src_files():
-        print(src_file)
-        for compiler in _compilers_[os.name]:
-            name, count, xml_output = test_single(func[compiler][1],
-                func[compiler][0], src_file, compiler, 1)
-            csv_data.append((compiler, name, count))
-            xml_string += xml_output
-    xml_string += '</testsuite>'
-
-    with open("results." + os.name + ".xml", "wt") as xml_file:
-        xml_file.write(xml_string)
-
-    for compiler in _compilers_[os.name]:
-        with open(compiler + ".csv", "a+t") as csv_file:
-            csv_file.write(','.join( 
-                map(lambda t: '"'+t[1]+'"', 
-                filter(lambda t: t[0] == compiler, 
-                    csv_data))))
-            csv_file.write('\n')
-            csv_file.write(','.join( 
-                map(lambda t: str(t[2]), 
-                filter(lambda t: t[0] == compiler, 
-                    csv_data))))
-            csv_file.write('\n')
-
-
-test_all(_function_)
+    return sorted(os.path.join(_here_, s) for s in os.listdir(_here_) if s.endswith(".cpp"))
+
+
+def main() -> int:
+    argv = sys.argv[1:]
+    flags = []
+    if "--" in argv:
+        flags = argv[argv.index("--") + 1:]
+        argv = argv[:argv.index("--")]
+    parser = argparse.ArgumentParser(description="Check the opcodes generated for canned sequences against a stored budget")
+    parser.add_argument("--compiler", default=os.environ.get("CXX"), help="compiler to use, defaults to $CXX")
+    parser.add_argument("--family", choices=sorted(_compile_info_.keys()), help="compiler family, defaults to guessing from the compiler name")
+    parser.add_argument("--output-dir", default=os.getcwd(), help="where to write binaries, disassembly and results")
+    parser.add_argument("--tolerance", type=float, default=10.0, help="percentage by which a count may exceed its budget, defaults to 10")
+    parser.add_argument("--update-budgets", action="store_true", help="store the counts measured as the new budgets for this compiler family")
+    parser.add_argument("sources", nargs="*", help="test sequences to check, defaults to all")
+    args = parser.parse_args(argv)
+
+    family = args.family or (detect_family(args.compiler) if args.compiler else ("msvc" if os.name == "nt" else "gcc"))
+    compiler = args.compiler or _default_compiler_[family]
+    sources = [os.path.abspath(s) for s in args.sources] or list_src_files()
+    if not os.path.isdir(args.output_dir):
+        os.makedirs(args.output_dir)
+    budgets = load_budgets()
+
+    results = [test_single(src_file, compiler, family, args.output_dir, budgets, args.tolerance, flags) for src_file in sources]
+    failed = [r for r in results if r[1] == -1 or (r[2] is not None and r[1] > allowed(r[2], args.tolerance))]
+
+    suffix = "" if len(sources) != 1 else "." + results[0][0]
+    with open(os.path.join(args.output_dir, "results." + family + suffix + ".xml"), "wt") as xml_file:
+        xml_file.write('<?xml version="1.0" encoding="UTF-8"?>\n<testsuite name="constexpr">\n')
+        xml_file.write("".join(r[3] for r in results))
+        xml_file.write('</testsuite>\n')
+    with open(os.path.join(args.output_dir, family + suffix + ".csv"), "wt") as csv_file:
+        csv_file.write(','.join('"' + r[0] + '"' for r in results) + '\n')
+        csv_file.write(','.join(str(r[1]) for r in results) + '\n')
+
+    if args.update_budgets:
+        for name, count, _, _ in results:
+            if count != -1:
+                budgets.setdefault(name, {})[family] = count
+        save_budgets(budgets)
+        return 0
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -30,9 +30,11 @@ debug = False
 #   20:	90                   	nop
 #   21:	5d                   	pop    %rbp
 #   22:	c3                   	retq   
+#
+# Newer binutils print call/ret rather than callq/retq, both are accepted.
 
 def get_call_target_objdump(l):
-  r = re.match(r".*callq\s+[0-9a-f]+\s+<(.+)>$", l)
+  r = re.match(r".*callq?\s+[0-9a-f]+\s+<(.+)>$", l)
   if r:
     return r.group(1)
   return None
@@ -72,12 +74,12 @@ _is_instruction_ = \
     }
 
 _is_normal_instruction_ = \
-    { 'objdump' : lambda l: _is_instruction_['objdump'](l) and 'retq' not in l and 'nop' not in l
+    { 'objdump' : lambda l: _is_instruction_['objdump'](l) and re.search(r"\sretq?\b", l) is None and 'nop' not in l
     , 'dumpbin' : lambda l: _is_instruction_['dumpbin'](l) and 'ret' not in l and 'nop' not in l
     }
 
 _is_call_instruction_ = \
-    { 'objdump' : lambda l: "callq" in l
+    { 'objdump' : lambda l: re.search(r"\scallq?\s", l) is not None
     , 'dumpbin' : lambda l: "call" in l
     }
 
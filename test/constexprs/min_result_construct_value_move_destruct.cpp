@@ -21,7 +21,7 @@ Distributed under the Boost Software License, Version 1.0.
           http://www.boost.org/LICENSE_1_0.txt)
 */
 
-#include "../../single-header/outcome.hpp"
+#include "../../include/outcome.hpp"
 
 extern QUICKCPPLIB_NOINLINE int test1()
 {
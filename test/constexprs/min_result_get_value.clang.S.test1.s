@@ -1,3 +0,0 @@
-  400630:	b8 05 00 00 00       	mov    $0x5,%eax
-  400635:	c3                   	retq
-  400636:	66 2e 0f 1f 84 00 00 	nopw   %cs:0x0(%rax,%rax,1)
@@ -0,0 +1,139 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/collect.hpp"
+#include "../../include/outcome/experimental/status_result.hpp"
+#include "../../include/outcome/outcome.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <forward_list>
+#include <string>
+#include <vector>
+
+namespace collect_test
+{
+  struct counted
+  {
+    static int copies, moves;
+    std::string v;
+    counted(std::string _v)  // NOLINT
+        : v(std::move(_v))
+    {
+    }
+    counted(const counted &o)
+        : v(o.v)
+    {
+      ++copies;
+    }
+    counted(counted &&o) noexcept
+        : v(std::move(o.v))
+    {
+      ++moves;
+    }
+    counted &operator=(const counted &) = default;
+    counted &operator=(counted &&) = default;
+    ~counted() = default;
+  };
+  int counted::copies, counted::moves;
+}  // namespace collect_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / collect, "Tests that collecting ranges of results works as intended")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using collect_test::counted;
+
+  // All successful, collected with one allocation, moved out of rvalue ranges
+  {
+    std::vector<result<counted>> in;
+    for(int n = 0; n < 100; n++)
+    {
+      in.emplace_back(std::to_string(n));
+    }
+    counted::copies = counted::moves = 0;
+    result<std::vector<counted>> r = collect(in);
+    BOOST_REQUIRE(r);
+    BOOST_CHECK(r.value().size() == 100);
+    BOOST_CHECK(r.value().capacity() == 100);
+    BOOST_CHECK(r.value()[42].v == "42");
+    BOOST_CHECK(counted::copies == 100);
+    BOOST_CHECK(in[42].value().v == "42");
+
+    counted::copies = counted::moves = 0;
+    r = collect(std::move(in));
+    BOOST_REQUIRE(r);
+    BOOST_CHECK(r.value()[99].v == "99");
+    BOOST_CHECK(counted::copies == 0);
+  }
+  // Stops at the first failure
+  {
+    std::vector<result<int>> in{1, 2, make_error_code(std::errc::invalid_argument), 4, make_error_code(std::errc::timed_out)};
+    auto r = collect(in);
+    BOOST_CHECK(!r);
+    BOOST_CHECK(r.error() == std::errc::invalid_argument);
+
+    std::vector<int> out{0};
+    result<void> r2 = collect_into(in, out);
+    BOOST_CHECK(r2.error() == std::errc::invalid_argument);
+    BOOST_CHECK((out == std::vector<int>{0, 1, 2}));
+  }
+  // Gathering all failures, with their indices
+  {
+    result<int> in[] = {1, make_error_code(std::errc::invalid_argument), 3, make_error_code(std::errc::timed_out)};
+    auto r = collect_all(in);
+    BOOST_CHECK((r.values == std::vector<int>{1, 3}));
+    BOOST_REQUIRE(r.failures.size() == 2);
+    BOOST_CHECK(r.failures[0].first == 1);
+    BOOST_CHECK(r.failures[0].second.error() == std::errc::invalid_argument);
+    BOOST_CHECK(r.failures[1].first == 3);
+    BOOST_CHECK(r.failures[1].second.error() == std::errc::timed_out);
+  }
+  // Unsized ranges, and outcome
+  {
+    std::forward_list<outcome<int>> in{1, 2, 3};
+    auto r = collect(in);
+    BOOST_CHECK((r.value() == std::vector<int>{1, 2, 3}));
+#ifdef __cpp_exceptions
+    in.push_front(std::make_exception_ptr(std::runtime_error("boom")));
+    r = collect(in);
+    BOOST_CHECK(!r.has_error());
+    BOOST_CHECK(r.has_exception());
+    auto r2 = collect_all(in);
+    BOOST_CHECK(r2.values.size() == 3);
+    BOOST_REQUIRE(r2.failures.size() == 1);
+    BOOST_CHECK(r2.failures[0].second.has_exception());
+#endif
+  }
+  // status_result
+  {
+    using experimental::status_result;
+    std::vector<status_result<int>> in;
+    in.emplace_back(1);
+    in.emplace_back(2);
+    auto r = collect(std::move(in));
+    BOOST_CHECK((r.value() == std::vector<int>{1, 2}));
+    in.clear();
+    in.emplace_back(SYSTEM_ERROR2_NAMESPACE::errc::permission_denied);
+    r = collect(std::move(in));
+    BOOST_CHECK(r.error() == SYSTEM_ERROR2_NAMESPACE::errc::permission_denied);
+  }
+}
@@ -21,7 +21,7 @@ Distributed under the Boost Software License, Version 1.0.
           http://www.boost.org/LICENSE_1_0.txt)
 */
 
-#if defined(__cpp_coroutines)
+#if defined(__cpp_coroutines) || defined(__cpp_impl_coroutine)
 
 #include "../../include/outcome/coroutine_support.hpp"
 #include "../../include/outcome/outcome.hpp"
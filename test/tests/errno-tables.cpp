@@ -0,0 +1,58 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/errno_tables.hpp"
+#include "../../include/outcome/utils.hpp"
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <ios>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / errno_tables, "Tests that the errno tables work as intended")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  static_assert(errno_is_errc(static_cast<int>(std::errc::no_such_file_or_directory)), "");
+  static_assert(errno_is_errc(static_cast<int>(std::errc::wrong_protocol_type)), "");
+  static_assert(!errno_is_errc(0), "");
+  static_assert(!errno_is_errc(-1), "");
+  static_assert(!errno_is_errc(1 << 20), "");
+  static_assert(errno_exception_kind(EINVAL) == errno_exception::invalid_argument, "");
+  static_assert(errno_exception_kind(ENOMEM) == errno_exception::bad_alloc, "");
+  static_assert(errno_exception_kind(ENOENT) == errno_exception::none, "");
+  static_assert(errno_exception_kind(-1) == errno_exception::none, "");
+
+  BOOST_CHECK(is_errno_category(std::generic_category()));
+#ifndef _WIN32
+  BOOST_CHECK(is_errno_category(std::system_category()));
+#endif
+  BOOST_CHECK(!is_errno_category(std::iostream_category()));
+
+#ifdef __cpp_exceptions
+  BOOST_CHECK_THROW(try_throw_std_exception_from_error(make_error_code(std::errc::invalid_argument)), std::invalid_argument);
+  BOOST_CHECK_THROW(try_throw_std_exception_from_error(make_error_code(std::errc::value_too_large)), std::overflow_error);
+  BOOST_CHECK_THROW(try_throw_std_exception_from_error(make_error_code(std::errc::not_enough_memory)), std::bad_alloc);
+  BOOST_CHECK_NO_THROW(try_throw_std_exception_from_error(make_error_code(std::errc::no_such_file_or_directory)));
+  BOOST_CHECK_NO_THROW(try_throw_std_exception_from_error(make_error_code(std::io_errc::stream)));
+  BOOST_CHECK_NO_THROW(try_throw_std_exception_from_error(std::error_code()));
+#endif
+}
@@ -0,0 +1,135 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/error_channel.hpp"
+#include "../../include/outcome/result.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_channel, "Tests that the error aggregation channel works as intended")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  static_assert(error_channel::coalescing, "error_code is not coalesced");
+  static_assert(!basic_error_channel<std::string>::coalescing, "std::string is coalesced");
+
+  // Identical errors coalesce, results push only their errors
+  {
+    error_channel ch(4);
+    BOOST_CHECK(ch.capacity() == 4);
+    for(int n = 0; n < 100; n++)
+    {
+      BOOST_CHECK(ch.push(make_error_code(std::errc::timed_out)));
+    }
+    BOOST_CHECK(ch.push(result<void>(success())));
+    BOOST_CHECK(ch.push(result<void>(make_error_code(std::errc::connection_reset))));
+    std::map<int, size_t> seen;
+    size_t entries = ch.drain([&](const std::error_code &ec, size_t count) {
+      BOOST_CHECK(ec.category() == std::generic_category());
+      seen[ec.value()] += count;
+    });
+    BOOST_CHECK(entries == 2);
+    BOOST_CHECK(seen[static_cast<int>(std::errc::timed_out)] == 100);
+    BOOST_CHECK(seen[static_cast<int>(std::errc::connection_reset)] == 1);
+    BOOST_CHECK(ch.drain([](const std::error_code &, size_t) {}) == 0);
+    BOOST_CHECK(ch.overflows() == 0);
+  }
+  // Without coalescing the ring fills, and overflows are counted
+  {
+    basic_error_channel<std::string> ch(4);
+    for(int n = 0; n < 6; n++)
+    {
+      BOOST_CHECK(ch.push(std::to_string(n)) == (n < 4));
+    }
+    BOOST_CHECK(ch.overflows() == 2);
+    std::vector<std::string> seen;
+    BOOST_CHECK(ch.drain([&](const std::string &e, size_t count) {
+      BOOST_CHECK(count == 1);
+      seen.push_back(e);
+    },
+                         3) == 3);
+    BOOST_CHECK(ch.push(std::string("4")));
+    BOOST_CHECK(ch.drain([&](const std::string &e, size_t /*unused*/) { seen.push_back(e); }) == 2);
+    BOOST_CHECK((seen == std::vector<std::string>{"0", "1", "2", "3", "4"}));
+    BOOST_CHECK(ch.push(std::string("left for the destructor")));
+  }
+#ifdef __cpp_exceptions
+  // If the consumer throws, the entry it was given remains for the next drain
+  {
+    error_channel ch(4);
+    for(int n = 0; n < 3; n++)
+    {
+      ch.push(make_error_code(std::errc::timed_out));
+    }
+    ch.push(std::error_code(EIO, std::system_category()));
+    try
+    {
+      ch.drain([](const std::error_code &, size_t) { throw std::runtime_error("consumer failed"); });
+      BOOST_CHECK(false);
+    }
+    catch(const std::runtime_error &)
+    {
+    }
+    ch.push(make_error_code(std::errc::timed_out));
+    size_t received = 0;
+    ch.drain([&](const std::error_code &, size_t count) { received += count; });
+    BOOST_CHECK(received == 5);
+  }
+#endif
+  // Many producers, one consumer, nothing lost that was not counted
+  {
+    error_channel ch(256, 8);
+    static constexpr int producers = 4, per_producer = 20000;
+    std::atomic<int> running{producers};
+    std::vector<std::thread> threads;
+    for(int p = 0; p < producers; p++)
+    {
+      threads.emplace_back([&, p] {
+        for(int n = 0; n < per_producer; n++)
+        {
+          ch.push(std::error_code(1 + (n + p) % 32, (n & 1) ? std::generic_category() : std::system_category()));
+        }
+        --running;
+      });
+    }
+    size_t received = 0;
+    auto consume = [&](const std::error_code &ec, size_t count) {
+      BOOST_CHECK(ec.value() >= 1 && ec.value() <= 32);
+      received += count;
+    };
+    while(running > 0)
+    {
+      ch.drain(consume);
+    }
+    ch.drain(consume);
+    for(auto &t : threads)
+    {
+      t.join();
+    }
+    BOOST_CHECK(received + ch.overflows() == static_cast<size_t>(producers) * per_producer);
+  }
+}
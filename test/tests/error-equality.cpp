@@ -0,0 +1,63 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/outcome.hpp"
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <ios>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_equality, "Tests that results compare errors as std::error_code does")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  const std::error_code codes[] = {make_error_code(std::errc::timed_out),                   //
+                                   make_error_code(std::errc::permission_denied),           //
+                                   std::error_code(ETIMEDOUT, std::system_category()),      //
+                                   std::error_code(ETIMEDOUT, std::iostream_category()),    //
+                                   make_error_code(std::io_errc::stream),                   //
+                                   std::error_code()};
+  const std::errc errcs[] = {std::errc::timed_out, std::errc::permission_denied, std::errc::io_error};
+  for(const auto &ec : codes)
+  {
+    const result<int> r(ec);
+    const outcome<int> o(ec);
+    for(auto e : errcs)
+    {
+      // Against an errc, as std::error_code == std::errc does
+      BOOST_CHECK((r == failure(e)) == (ec == e));
+      BOOST_CHECK((r != failure(e)) == (ec != e));
+      BOOST_CHECK((o == failure(e)) == (ec == e));
+      BOOST_CHECK((o != failure(e)) == (ec != e));
+    }
+    for(const auto &ec2 : codes)
+    {
+      // Against another error code, and results of them
+      const result<int> r2(ec2);
+      BOOST_CHECK((r == failure(ec2)) == (ec == ec2));
+      BOOST_CHECK((r == r2) == (ec == ec2));
+      BOOST_CHECK((r != r2) == (ec != ec2));
+      BOOST_CHECK((o == outcome<int>(ec2)) == (ec == ec2));
+    }
+    BOOST_CHECK(r != result<int>(5));
+  }
+}
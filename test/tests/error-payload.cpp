@@ -0,0 +1,143 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/error_payload.hpp"
+#include "../../include/outcome/outcome.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / error_payload, "Tests that the intrusive error payload works as intended")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  static_assert(sizeof(error_payload) == sizeof(void *), "error_payload is not a single pointer");
+  static_assert(trait::is_exception_ptr_available<error_payload>::value, "error_payload is not an exception ptr");
+  static_assert(trait::is_exception_ptr_available<local_error_payload>::value, "local_error_payload is not an exception ptr");
+  static_assert(trait::is_error_type<error_payload>::value, "error_payload is not an error type");
+  static_assert(std::is_nothrow_copy_constructible<error_payload>::value && std::is_nothrow_move_constructible<error_payload>::value, "error_payload copies can throw");
+
+  // Empty
+  {
+    error_payload e;
+    BOOST_CHECK(!e);
+    BOOST_CHECK(e == nullptr);
+    BOOST_CHECK(e.use_count() == 0);
+    BOOST_CHECK(e.get_if<int>() == nullptr);
+    BOOST_CHECK(!e.to_exception_ptr());
+    e.rethrow();  // does nothing
+    BOOST_CHECK(!error_payload(std::exception_ptr()));
+  }
+  // Copies share one object
+  {
+    error_payload a = make_error_payload<std::runtime_error>("boom");
+    BOOST_CHECK(a);
+    BOOST_CHECK(a.use_count() == 1);
+    BOOST_CHECK(std::string(a.what()) == "boom");
+    BOOST_CHECK(a.get_if<std::runtime_error>() != nullptr);
+    BOOST_CHECK(a.get_if<std::logic_error>() == nullptr);
+    error_payload b(a), c;
+    c = b;
+    BOOST_CHECK(a.use_count() == 3);
+    BOOST_CHECK(a == b && b == c);
+    error_payload d(std::move(c));
+    BOOST_CHECK(!c);  // NOLINT
+    BOOST_CHECK(a.use_count() == 3);
+    b = nullptr;
+    d = d;
+    BOOST_CHECK(a.use_count() == 2);
+  }
+  // Anything, not just exceptions
+  {
+    local_error_payload a = make_error_payload<std::string, false>("context");
+    BOOST_CHECK(*a.get_if<std::string>() == "context");
+    BOOST_CHECK(std::string(a.what()).empty());
+  }
+#ifdef __cpp_exceptions
+  // Rethrows, and converts to std::exception_ptr
+  {
+    error_payload a = make_error_payload<std::out_of_range>("out");
+    try
+    {
+      a.rethrow();
+      BOOST_CHECK(false);
+    }
+    catch(const std::out_of_range &e)
+    {
+      BOOST_CHECK(std::string(e.what()) == "out");
+    }
+    std::exception_ptr ep = a.to_exception_ptr();
+    BOOST_CHECK(ep);
+    BOOST_CHECK_THROW(std::rethrow_exception(ep), std::out_of_range);
+
+    // Wraps a std::exception_ptr, and gives it back unchanged
+    error_payload b(std::make_exception_ptr(std::invalid_argument("wrapped")));
+    BOOST_CHECK(std::string(b.what()) == "wrapped");
+    BOOST_CHECK(b.get_if<std::exception_ptr>() != nullptr);
+    BOOST_CHECK(b.to_exception_ptr() == *b.get_if<std::exception_ptr>());
+    BOOST_CHECK_THROW(b.rethrow(), std::invalid_argument);
+  }
+  // As the exception type of outcome
+  {
+    using out = outcome<int, std::error_code, error_payload>;
+    out a(make_error_payload<std::domain_error>("domain"));
+    BOOST_CHECK(a.has_exception());
+    BOOST_CHECK(a.exception().get_if<std::domain_error>() != nullptr);
+    BOOST_CHECK_THROW(a.value(), std::domain_error);
+    out b(std::make_error_code(std::errc::invalid_argument));
+    BOOST_CHECK_THROW(b.value(), std::system_error);
+    BOOST_CHECK_THROW(b.failure().rethrow(), std::system_error);
+    out c(5);
+    BOOST_CHECK(c.value() == 5);
+    out d(a);
+    BOOST_CHECK(d.exception() == a.exception());
+    BOOST_CHECK(a.exception().use_count() == 2);
+
+    using lout = outcome<int, std::error_code, local_error_payload>;
+    lout e(make_error_payload<std::domain_error, false>("domain"));
+    BOOST_CHECK_THROW(e.value(), std::domain_error);
+  }
+#endif
+  // The thread safe payload can be copied and released concurrently
+  {
+    error_payload a = make_error_payload<std::runtime_error>("shared");
+    std::vector<std::thread> threads;
+    for(int n = 0; n < 4; n++)
+    {
+      threads.emplace_back([a] {
+        for(int i = 0; i < 10000; i++)
+        {
+          error_payload b(a);
+          (void) b;
+        }
+      });
+    }
+    for(auto &t : threads)
+    {
+      t.join();
+    }
+    BOOST_CHECK(a.use_count() == 1);
+  }
+}
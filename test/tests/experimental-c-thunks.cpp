@@ -0,0 +1,67 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/experimental/c_thunks.hpp"
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+CXX_DECLARE_RESULT_SYSTEM(c_thunks_test, size_t);
+CXX_DECLARE_RESULT_SYSTEM_BATCH(c_thunks_test);
+
+namespace c_thunks_test
+{
+  namespace outcome_e = OUTCOME_V2_NAMESPACE::experimental;
+
+  outcome_e::status_result<size_t> halve(size_t v) noexcept
+  {
+    if(v & 1U)
+    {
+      return outcome_e::errc::invalid_argument;
+    }
+    return v / 2;
+  }
+}  // namespace c_thunks_test
+
+CXX_DEFINE_RESULT_SYSTEM_THUNK(c_thunks_test, c_thunks_test_halve, c_thunks_test::halve, (size_t v), (v))
+CXX_DEFINE_RESULT_SYSTEM_BATCH_THUNK(c_thunks_test, c_thunks_test_halve_n, c_thunks_test::halve, size_t)
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / c_thunks, "Tests that the C thunk generators work as intended")
+{
+  {
+    CXX_RESULT_SYSTEM(c_thunks_test) r = c_thunks_test_halve(8);
+    BOOST_CHECK(CXX_RESULT_HAS_VALUE(r));
+    BOOST_CHECK(r.value == 4);
+    r = c_thunks_test_halve(7);
+    BOOST_CHECK(CXX_RESULT_HAS_ERROR(r));
+    BOOST_CHECK(r.error.value == EINVAL);
+  }
+  {
+    const size_t inputs[] = {2, 4, 5, 8, 9};
+    CXX_RESULT_SYSTEM(c_thunks_test) results[5];
+    BOOST_CHECK(c_thunks_test_halve_n(inputs, 5, results) == 2);
+    BOOST_CHECK(CXX_RESULT_SYSTEM_COUNT_ERRORS(c_thunks_test, results, 5) == 2);
+    BOOST_CHECK(CXX_RESULT_SYSTEM_FIRST_ERROR(c_thunks_test, results, 5) == 2);
+    BOOST_CHECK(CXX_RESULT_SYSTEM_FIRST_ERROR(c_thunks_test, results, 2) == 2);
+    BOOST_CHECK(results[3].value == 4);
+  }
+}
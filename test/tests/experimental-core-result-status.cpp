@@ -347,4 +347,43 @@ BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / result, "Tests that the resul
     }
   }
 #endif
+
+  // Test interned messages
+  {
+    using OUTCOME_V2_NAMESPACE::experimental::cached_message;
+    result<int> a(generic_code(errc::no_such_file_or_directory)), b(generic_code(errc::no_such_file_or_directory)), c(generic_code(errc::permission_denied));
+    BOOST_CHECK(cached_message(a.error()).str() == a.error().message().c_str());
+    BOOST_CHECK(&cached_message(a.error()).str() == &cached_message(b.error()).str());
+    BOOST_CHECK(&cached_message(a.error()).str() != &cached_message(c.error()).str());
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+    BOOST_CHECK(&cached_message(a.error()).str() != &cached_message(posix_code(ENOENT)).str());
+#endif
+    BOOST_CHECK(cached_message(system_code()).str().empty());
+  }
+  // Test errno codes go into the generic domain where possible
+  {
+    using OUTCOME_V2_NAMESPACE::experimental::errno_code;
+    BOOST_CHECK(errno_code(ENOENT).domain() == generic_code_domain);
+    BOOST_CHECK(errno_code(ENOENT) == errc::no_such_file_or_directory);
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+    BOOST_CHECK(errno_code(4000).domain() == posix_code_domain);
+#else
+    BOOST_CHECK(errno_code(4000).domain() == generic_code_domain);
+#endif
+  }
+  // Test comparisons against errc, which skip the domains for generic and POSIX codes
+  {
+    result<int> a(generic_code(errc::timed_out)), c(errc::permission_denied);
+    BOOST_CHECK(a == OUTCOME_V2_NAMESPACE::failure(errc::timed_out));
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+    result<int> b(posix_code(ETIMEDOUT));
+    BOOST_CHECK(b == OUTCOME_V2_NAMESPACE::failure(errc::timed_out));
+#endif
+    BOOST_CHECK(c != OUTCOME_V2_NAMESPACE::failure(errc::timed_out));
+    BOOST_CHECK(!(a != OUTCOME_V2_NAMESPACE::failure(errc::timed_out)));
+#ifdef __cpp_exceptions
+    result<int, status_code_payload> d{payload{errc::timed_out, "niall"}};
+    BOOST_CHECK(d == OUTCOME_V2_NAMESPACE::failure(errc::timed_out));
+#endif
+  }
 }
@@ -0,0 +1,163 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/experimental/status_result.hpp"
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+namespace small_status_result_test
+{
+  // An errno plus a file offset plus an object id
+  struct file_failure
+  {
+    int errcode;
+    uint64_t offset;
+    uint64_t object_id;
+  };
+
+  class _file_failure_domain;
+  using file_failure_code = SYSTEM_ERROR2_NAMESPACE::status_code<_file_failure_domain>;
+  class _file_failure_domain : public SYSTEM_ERROR2_NAMESPACE::status_code_domain
+  {
+    template <class> friend class SYSTEM_ERROR2_NAMESPACE::status_code;
+    using _base = SYSTEM_ERROR2_NAMESPACE::status_code_domain;
+
+  public:
+    using value_type = file_failure;
+    using string_ref = _base::string_ref;
+
+    static int copies;
+
+  public:
+    constexpr _file_failure_domain() noexcept
+        : _base(0x5d1d8ab4c3b2e1f7)
+    {
+    }
+
+    static inline constexpr const _file_failure_domain &get();
+
+    virtual _base::string_ref name() const noexcept override final { return string_ref("file failure domain"); }  // NOLINT
+  protected:
+    virtual bool _do_failure(const SYSTEM_ERROR2_NAMESPACE::status_code<void> &code) const noexcept override final  // NOLINT
+    {
+      return static_cast<const file_failure_code &>(code).value().errcode != 0;  // NOLINT
+    }
+    virtual bool _do_equivalent(const SYSTEM_ERROR2_NAMESPACE::status_code<void> &code1, const SYSTEM_ERROR2_NAMESPACE::status_code<void> &code2) const noexcept override final  // NOLINT
+    {
+      const auto &c1 = static_cast<const file_failure_code &>(code1);  // NOLINT
+      if(code2.domain() == *this)
+      {
+        const auto &c2 = static_cast<const file_failure_code &>(code2);  // NOLINT
+        return c1.value().errcode == c2.value().errcode && c1.value().offset == c2.value().offset && c1.value().object_id == c2.value().object_id;
+      }
+      if(code2.domain() == SYSTEM_ERROR2_NAMESPACE::generic_code_domain)
+      {
+        const auto &c2 = static_cast<const SYSTEM_ERROR2_NAMESPACE::generic_code &>(code2);  // NOLINT
+        return static_cast<int>(c2.value()) == c1.value().errcode;
+      }
+      return false;
+    }
+    virtual SYSTEM_ERROR2_NAMESPACE::generic_code _generic_code(const SYSTEM_ERROR2_NAMESPACE::status_code<void> &code) const noexcept override final  // NOLINT
+    {
+      return static_cast<SYSTEM_ERROR2_NAMESPACE::errc>(static_cast<const file_failure_code &>(code).value().errcode);  // NOLINT
+    }
+    virtual _base::string_ref _do_message(const SYSTEM_ERROR2_NAMESPACE::status_code<void> &code) const noexcept override final  // NOLINT
+    {
+      const auto &c = static_cast<const file_failure_code &>(code);  // NOLINT
+      return string_ref(SYSTEM_ERROR2_NAMESPACE::detail::generic_code_message(static_cast<SYSTEM_ERROR2_NAMESPACE::errc>(c.value().errcode)));
+    }
+#ifdef __cpp_exceptions
+    virtual void _do_throw_exception(const SYSTEM_ERROR2_NAMESPACE::status_code<void> &code) const override final  // NOLINT
+    {
+      throw SYSTEM_ERROR2_NAMESPACE::status_error<_file_failure_domain>(static_cast<const file_failure_code &>(code));  // NOLINT
+    }
+#endif
+    // The domain decides how its erased values are copied
+    virtual void _do_erased_copy(SYSTEM_ERROR2_NAMESPACE::status_code<void> &dst, const SYSTEM_ERROR2_NAMESPACE::status_code<void> &src, size_t bytes) const override final  // NOLINT
+    {
+      ++copies;
+      memcpy(static_cast<void *>(&dst), &src, bytes);  // NOLINT
+    }
+  };
+  int _file_failure_domain::copies;
+  constexpr _file_failure_domain file_failure_domain;
+  inline constexpr const _file_failure_domain &_file_failure_domain::get()
+  {
+    return file_failure_domain;
+  }
+
+  OUTCOME_V2_NAMESPACE::experimental::small_status_result<size_t, 24> read_at(uint64_t offset) noexcept
+  {
+    if(offset > 100)
+    {
+      return file_failure_code(SYSTEM_ERROR2_NAMESPACE::in_place, file_failure{EINVAL, offset, 78});
+    }
+    return static_cast<size_t>(offset);
+  }
+}  // namespace small_status_result_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / status_code / small_status_result, "Tests that small_status_result works as intended")
+{
+  using namespace OUTCOME_V2_NAMESPACE::experimental;
+  using namespace small_status_result_test;
+
+  static_assert(sizeof(small_status_code<16>) == sizeof(void *) + 16, "");
+  static_assert(sizeof(small_status_code<32>) == sizeof(void *) + 32, "");
+  static_assert(fits_small_status_code<file_failure_code, 24>::value, "");
+  static_assert(!fits_small_status_code<file_failure_code, 16>::value, "");
+  static_assert(fits_small_status_code<generic_code, 16>::value, "");
+  static_assert(!std::is_constructible<small_status_code<16>, file_failure_code>::value, "");
+
+  // Success
+  BOOST_CHECK(read_at(5).value() == 5);
+
+  // The whole payload is carried inline
+  auto r = read_at(1000);
+  BOOST_REQUIRE(r.has_error());
+  BOOST_CHECK(r.error().domain() == file_failure_domain);
+  BOOST_CHECK(r.error() == errc::invalid_argument);
+  BOOST_CHECK(r.error() == file_failure_code(in_place, file_failure{EINVAL, 1000, 78}));
+  {
+    const auto &c = static_cast<const file_failure_code &>(static_cast<const status_code<void> &>(r.error()));
+    BOOST_CHECK(c.value().offset == 1000);
+    BOOST_CHECK(c.value().object_id == 78);
+  }
+#ifdef __cpp_exceptions
+  BOOST_CHECK_THROW(r.value(), status_error<_file_failure_domain>);
+#endif
+
+  // Copies go through the domain
+  _file_failure_domain::copies = 0;
+  small_status_code<24> copy = r.error().clone();
+  BOOST_CHECK(_file_failure_domain::copies == 1);
+  BOOST_CHECK(copy == r.error());
+
+  // Smaller codes fit, and the budget can be checked explicitly
+  small_status_result<void, 16> r2 = to_small_status_code<16>(generic_code(errc::no_space_on_device));
+  BOOST_CHECK(r2.error() == errc::no_space_on_device);
+  small_status_result<int, 32> r3 = to_small_status_code<32>(file_failure_code(in_place, file_failure{EIO, 1, 2}));
+  BOOST_CHECK(r3.error() == errc::io_error);
+}
@@ -0,0 +1,99 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/iostream_support.hpp"
+#include "../../include/outcome/message_cache.hpp"
+#include "../../include/outcome/std_result.hpp"
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <thread>
+#include <vector>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / message_cache, "Tests that cached_message() works as intended")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  const std::error_code ec1 = make_error_code(std::errc::no_such_file_or_directory);
+  const std::error_code ec2 = make_error_code(std::errc::permission_denied);
+  const std::error_code ec3(ENOENT, std::system_category());
+
+  // Same text as message(), interned per category and value
+  BOOST_CHECK(cached_message(ec1).is_interned());
+  BOOST_CHECK(cached_message(ec1).str() == ec1.message());
+  BOOST_CHECK(&cached_message(ec1).str() == &cached_message(ec1).str());
+  BOOST_CHECK(cached_message(ec2).str() == ec2.message());
+  BOOST_CHECK(&cached_message(ec1).str() != &cached_message(ec2).str());
+  BOOST_CHECK(cached_message(ec3).str() == ec3.message());
+  BOOST_CHECK(&cached_message(ec1).str() != &cached_message(ec3).str());
+
+  // Concurrent first use agrees on one message
+  {
+    const std::error_code ec(EXDEV, std::generic_category());
+    std::vector<const std::string *> seen(8);
+    std::vector<std::thread> threads;
+    for(size_t n = 0; n < seen.size(); n++)
+    {
+      threads.emplace_back([&, n] { seen[n] = &cached_message(ec).str(); });
+    }
+    for(auto &t : threads)
+    {
+      t.join();
+    }
+    for(auto *s : seen)
+    {
+      BOOST_CHECK(s == seen.front());
+    }
+    BOOST_CHECK(*seen.front() == ec.message());
+  }
+
+  // Many more codes than there are buckets, and than may be interned
+  {
+    const int count = OUTCOME_MESSAGE_CACHE_MAX_ENTRIES + 1000;
+    std::vector<const std::string *> seen;
+    size_t interned = 0;
+    bool ok = true;
+    for(int n = 0; n < count; n++)
+    {
+      const std::error_code ec(n, std::generic_category());
+      auto m = cached_message(ec);
+      ok = ok && m.str() == ec.message();
+      seen.push_back(m.is_interned() ? &m.str() : nullptr);
+      interned += m.is_interned();
+    }
+    BOOST_CHECK(ok);
+    BOOST_CHECK(interned > 0);
+    BOOST_CHECK(interned <= OUTCOME_MESSAGE_CACHE_MAX_ENTRIES);
+    for(int n = 0; n < count; n++)
+    {
+      const std::error_code ec(n, std::generic_category());
+      auto m = cached_message(ec);
+      ok = ok && m.is_interned() == (seen[n] != nullptr) && (!m.is_interned() || &m.str() == seen[n]) && m.str() == ec.message();
+    }
+    BOOST_CHECK(ok);
+    BOOST_CHECK(cached_message(ec1).is_interned());
+  }
+
+  // print() uses it
+  result<int> r(ec2);
+  BOOST_CHECK(print(r).find(ec2.message()) != std::string::npos);
+}
@@ -0,0 +1,117 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/outcome.hpp"
+#include "../../include/outcome/parallel_collect.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / parallel_collect, "Tests that parallel transform and collect works as intended")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  std::vector<int> in(100000);
+  std::iota(in.begin(), in.end(), 0);
+
+  // All successful, in order
+  {
+    auto r = parallel_transform_collect(in, [](int v) -> result<std::string> { return std::to_string(v); }, 4);
+    BOOST_REQUIRE(r);
+    BOOST_CHECK(r.value().size() == in.size());
+    BOOST_CHECK(r.value()[0] == "0");
+    BOOST_CHECK(r.value()[99999] == "99999");
+    BOOST_CHECK(parallel_transform_collect(std::vector<int>(), [](int v) -> result<int> { return v; }).value().empty());
+  }
+  // The failure of the lowest index is returned, whatever the timing
+  for(size_t chunk : {1, 7, 1000})
+  {
+    auto r = parallel_transform_collect(in,
+                                        [](int v) -> result<int> {
+                                          if(v == 60000 || v == 99000)
+                                          {
+                                            return make_error_code(std::errc::invalid_argument);
+                                          }
+                                          if(v == 54321)
+                                          {
+                                            return make_error_code(std::errc::timed_out);
+                                          }
+                                          return v;
+                                        },
+                                        8, chunk);
+    BOOST_REQUIRE(!r);
+    BOOST_CHECK(r.error() == std::errc::timed_out);
+  }
+  // Other threads stop soon after the first failure
+  {
+    std::atomic<size_t> calls{0};
+    auto r = parallel_transform_collect(in,
+                                        [&](int v) -> result<int> {
+                                          ++calls;
+                                          if(v == 100)
+                                          {
+                                            return make_error_code(std::errc::invalid_argument);
+                                          }
+                                          return v;
+                                        },
+                                        4, 64);
+    BOOST_CHECK(!r);
+    BOOST_CHECK(calls < in.size() / 2);
+  }
+  // outcome, and exceptions thrown by the callable
+  {
+    auto r = parallel_transform_collect(in, [](int v) -> outcome<int> {
+      if(v == 5)
+      {
+        return make_error_code(std::errc::invalid_argument);
+      }
+      return v;
+    });
+    BOOST_CHECK(r.has_error());
+#ifdef __cpp_exceptions
+    BOOST_CHECK_THROW(parallel_transform_collect(in,
+                                                 [](int v) -> result<int> {
+                                                   if(v % 1000 == 999)
+                                                   {
+                                                     throw std::runtime_error(std::to_string(v));
+                                                   }
+                                                   return v;
+                                                 },
+                                                 4, 10),
+                      std::runtime_error);
+    bool thrown = false;
+    try
+    {
+      (void) parallel_transform_collect(in, [](int v) -> result<int> { return (v >= 70000) ? throw std::runtime_error(std::to_string(v)) : v; }, 4, 10);
+    }
+    catch(const std::runtime_error &e)
+    {
+      BOOST_CHECK(std::string(e.what()) == "70000");
+      thrown = true;
+    }
+    BOOST_CHECK(thrown);
+#endif
+  }
+}
@@ -0,0 +1,131 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/payload_arena.hpp"
+#include "../../include/outcome/result.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <thread>
+
+namespace payload_arena_test
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+
+  // The outcome_payload pattern, with the payload allocated from the current arena
+  struct failure_info
+  {
+    std::error_code ec;
+    outcome::arena_string context;
+  };
+  inline const std::error_code &make_error_code(const failure_info &fi) { return fi.ec; }
+  inline void outcome_throw_as_system_error_with_payload(const failure_info &fi) { OUTCOME_THROW_EXCEPTION(std::system_error(fi.ec, fi.context.c_str())); }
+
+  outcome::result<int, failure_info> parse(const char *s)
+  {
+    return failure_info{make_error_code(std::errc::invalid_argument), outcome::arena_string("could not parse the request field ") + s};
+  }
+}  // namespace payload_arena_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / payload_arena, "Tests that the error payload arena works as intended")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using namespace payload_arena_test;
+
+  // Bump allocation, alignment, and growing by chunks
+  {
+    payload_arena arena(256);
+    BOOST_CHECK(arena.chunks() == 0);
+    auto *a = static_cast<char *>(arena.allocate(1, 1));
+    auto *b = static_cast<char *>(arena.allocate(1, 1));
+    BOOST_CHECK(b == a + 1);
+    auto *c = arena.allocate(8, 64);
+    BOOST_CHECK(reinterpret_cast<uintptr_t>(c) % 64 == 0);
+    BOOST_CHECK(arena.chunks() == 1);
+    arena.allocate(1000);  // bigger than a chunk
+    BOOST_CHECK(arena.chunks() == 2);
+    BOOST_CHECK(arena.bytes_used() == 1010);
+    arena.reset();
+    BOOST_CHECK(arena.chunks() == 1);
+    BOOST_CHECK(arena.bytes_used() == 0);
+    arena.release();
+    BOOST_CHECK(arena.chunks() == 0);
+  }
+  // Allocates from an initial buffer first
+  {
+    alignas(std::max_align_t) char buffer[128];
+    payload_arena arena(buffer, sizeof(buffer));
+    auto *a = static_cast<char *>(arena.allocate(100));
+    BOOST_CHECK(a == buffer);
+    BOOST_CHECK(arena.chunks() == 0);
+    arena.allocate(100);
+    BOOST_CHECK(arena.chunks() == 1);
+    arena.release();
+    BOOST_CHECK(arena.allocate(16) == buffer);
+  }
+  // Scopes nest, and are per thread
+  {
+    BOOST_CHECK(current_payload_arena() == nullptr);
+    payload_arena a, b;
+    {
+      payload_arena_scope sa(a);
+      BOOST_CHECK(current_payload_arena() == &a);
+      {
+        payload_arena_scope sb(b);
+        BOOST_CHECK(current_payload_arena() == &b);
+        payload_arena *other = &a;
+        std::thread([&] { other = current_payload_arena(); }).join();
+        BOOST_CHECK(other == nullptr);
+      }
+      BOOST_CHECK(current_payload_arena() == &a);
+    }
+    BOOST_CHECK(current_payload_arena() == nullptr);
+  }
+  // Payloads allocate from the arena while in scope, and copies out of scope go to the heap
+  {
+    payload_arena arena;
+    arena_string escaped;
+    {
+      payload_arena_scope scope(arena);
+      auto r = parse("content-length");
+      BOOST_CHECK(!r);
+      BOOST_CHECK(r.error().ec == std::errc::invalid_argument);
+      BOOST_CHECK(r.error().context == "could not parse the request field content-length");
+      BOOST_CHECK(r.error().context.get_allocator().arena() == &arena);
+      BOOST_CHECK(arena.bytes_used() > 0);
+#ifdef __cpp_exceptions
+      BOOST_CHECK_THROW(r.value(), std::system_error);
+#endif
+      size_t used = arena.bytes_used();
+      auto r2 = parse("host");
+      BOOST_CHECK(arena.bytes_used() > used);
+      BOOST_CHECK(arena.chunks() == 1);
+
+      escaped = r.error().context;  // copy assignment keeps escaped's heap allocator
+    }
+    arena_string copied(escaped);
+    BOOST_CHECK(escaped.get_allocator().arena() == nullptr);
+    BOOST_CHECK(copied.get_allocator().arena() == nullptr);
+    arena.reset();
+    BOOST_CHECK(copied == "could not parse the request field content-length");
+  }
+}
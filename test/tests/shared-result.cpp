@@ -0,0 +1,117 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/shared_result.hpp"
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / shared_result, "Tests that the one-shot result slot works as intended")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  static_assert(sizeof(result_slot<int>) <= sizeof(result<int>) + sizeof(uint64_t), "result_slot adds more than a word");
+
+  // Single threaded
+  {
+    result_slot<std::string> a;
+    BOOST_CHECK(!a.ready());
+    BOOST_CHECK(a.try_get() == nullptr);
+    BOOST_CHECK(a.wait_for(std::chrono::milliseconds(1)) == nullptr);
+    BOOST_CHECK(a.set_value("hello"));
+    BOOST_CHECK(!a.set_value("again"));
+    BOOST_CHECK(!a.set_error(make_error_code(std::errc::invalid_argument)));
+    BOOST_CHECK(a.ready());
+    BOOST_CHECK(a.try_get()->value() == "hello");
+    BOOST_CHECK(a.wait().value() == "hello");
+
+    result_slot<void> b;
+    BOOST_CHECK(b.set_error(make_error_code(std::errc::timed_out)));
+    BOOST_CHECK(b.wait().error() == std::errc::timed_out);
+
+    result_slot<int> c;
+    BOOST_CHECK(c.set(result<int>(5)));
+    BOOST_CHECK(c.wait_until(std::chrono::steady_clock::now())->value() == 5);
+  }
+  // Waiters are woken by the producer
+  {
+    result_slot<int> a;
+    std::vector<std::thread> consumers;
+    std::atomic<int> sum{0};
+    for(int n = 0; n < 4; n++)
+    {
+      consumers.emplace_back([&] { sum += a.wait().value(); });
+    }
+    std::thread producer([&] {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      a.set_value(3);
+    });
+    producer.join();
+    for(auto &t : consumers)
+    {
+      t.join();
+    }
+    BOOST_CHECK(sum == 12);
+  }
+  // Timed waits time out, then succeed
+  {
+    result_slot<int> a;
+    auto begin = std::chrono::steady_clock::now();
+    BOOST_CHECK(a.wait_for(std::chrono::milliseconds(20)) == nullptr);
+    BOOST_CHECK(std::chrono::steady_clock::now() - begin >= std::chrono::milliseconds(20));
+    std::thread producer([&] { a.set_error(make_error_code(std::errc::operation_canceled)); });
+    result<int> *r = a.wait_for(std::chrono::seconds(10));
+    BOOST_CHECK(r != nullptr);
+    BOOST_CHECK(r != nullptr && r->error() == std::errc::operation_canceled);
+    producer.join();
+  }
+  // Shared ownership between producer and consumer
+  {
+    shared_result<std::string> a;
+    BOOST_CHECK(a);
+    std::thread producer([b = a] { b->set_value(1000, 'x'); });
+    BOOST_CHECK(a->wait().value().size() == 1000);
+    producer.join();
+    shared_result<std::string> c(a), d(std::move(c));
+    BOOST_CHECK(!c);  // NOLINT
+    BOOST_CHECK(&*d == &*a);
+  }
+  // Many slots, many threads
+  {
+    std::vector<shared_result<int>> slots(1000);
+    std::thread producer([slots] {
+      for(size_t n = 0; n < slots.size(); n++)
+      {
+        slots[n]->set_value(static_cast<int>(n));
+      }
+    });
+    long long total = 0;
+    for(auto &s : slots)
+    {
+      total += s->wait().value();
+    }
+    producer.join();
+    BOOST_CHECK(total == 999 * 1000 / 2);
+  }
+}
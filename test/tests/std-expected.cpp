@@ -0,0 +1,127 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/result.hpp"
+#include "../../include/outcome/std_expected.hpp"
+
+#ifdef OUTCOME_FOUND_EXPECTED_HEADER
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <string>
+
+namespace std_expected_test
+{
+  namespace outcome = OUTCOME_V2_NAMESPACE;
+
+  struct counted
+  {
+    static int copies, moves;
+    std::string v;
+    explicit counted(std::string _v)
+        : v(std::move(_v))
+    {
+    }
+    counted(const counted &o)
+        : v(o.v)
+    {
+      ++copies;
+    }
+    counted(counted &&o) noexcept
+        : v(std::move(o.v))
+    {
+      ++moves;
+    }
+    counted &operator=(const counted &) = default;
+    counted &operator=(counted &&) = default;
+    ~counted() = default;
+  };
+  int counted::copies, counted::moves;
+
+  std::expected<int, std::error_code> legacy(int x)
+  {
+    if(x < 0)
+    {
+      return std::unexpected(make_error_code(std::errc::invalid_argument));
+    }
+    return x * 2;
+  }
+  outcome::result<int> modern(int x)
+  {
+    OUTCOME_TRY(v, legacy(x));
+    return v + 1;
+  }
+  outcome::result<void> modern_void(int x)
+  {
+    OUTCOME_TRYV(legacy(x));
+    return outcome::success();
+  }
+}  // namespace std_expected_test
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / std_expected, "Tests that std::expected interoperates as intended")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  using namespace std_expected_test;
+
+  // TRY on std::expected
+  BOOST_CHECK(modern(5).value() == 11);
+  BOOST_CHECK(modern(-1).error() == std::errc::invalid_argument);
+  BOOST_CHECK(modern_void(-1).error() == std::errc::invalid_argument);
+
+  // Conversions move only the member present
+  {
+    std::expected<counted, std::error_code> e(std::in_place, "hello");
+    counted::copies = counted::moves = 0;
+    result<counted> r(std::move(e));
+    BOOST_CHECK(r.value().v == "hello");
+    BOOST_CHECK(counted::copies == 0);
+    BOOST_CHECK(counted::moves == 1);
+
+    counted::copies = counted::moves = 0;
+    std::expected<counted, std::error_code> e2 = to_expected(std::move(r));
+    BOOST_CHECK(e2->v == "hello");
+    BOOST_CHECK(counted::copies == 0);
+    BOOST_CHECK(counted::moves == 1);
+
+    result<counted> r2(make_error_code(std::errc::timed_out));
+    auto e3 = to_expected(r2);
+    BOOST_CHECK(!e3.has_value());
+    BOOST_CHECK(e3.error() == std::errc::timed_out);
+    result<counted> r3(std::move(e3));
+    BOOST_CHECK(r3.error() == std::errc::timed_out);
+  }
+  // void
+  {
+    result<void> r(success());
+    std::expected<void, std::error_code> e = to_expected(r);
+    BOOST_CHECK(e.has_value());
+    result<void> r2(std::expected<void, std::error_code>(std::unexpect, make_error_code(std::errc::io_error)));
+    BOOST_CHECK(r2.error() == std::errc::io_error);
+  }
+}
+#else
+int main(void)
+{
+  return 0;
+}
+#endif
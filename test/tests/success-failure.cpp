@@ -21,11 +21,82 @@ Distributed under the Boost Software License, Version 1.0.
           http://www.boost.org/LICENSE_1_0.txt)
 */
 
-#include "../../include/outcome/result.hpp"
+#include "../../include/outcome/outcome.hpp"
 #include "quickcpplib/boost/test/unit_test.hpp"
 
 #include <iostream>
 
+namespace success_failure_test
+{
+  // Counts constructions and destructions, to check failure_type constructs only what is present
+  int constructed, destroyed;
+  template <int N> struct counted
+  {
+    int v{0};
+    counted() { ++constructed; }
+    counted(int _v)  // NOLINT
+        : v(_v)
+    {
+      ++constructed;
+    }
+    counted(const counted &o)
+        : v(o.v)
+    {
+      ++constructed;
+    }
+    counted(counted &&o) noexcept
+        : v(o.v)
+    {
+      ++constructed;
+    }
+    counted &operator=(const counted &) = default;
+    counted &operator=(counted &&) = default;
+    ~counted() { ++destroyed; }
+  };
+
+  // A large value which counts its copies and moves
+  struct buffer
+  {
+    static int copies_or_moves;
+    char data[4096];
+    size_t length;
+    explicit buffer(size_t _length)
+        : data{}
+        , length(_length)
+    {
+    }
+    buffer(const buffer &o)
+        : length(o.length)
+    {
+      ++copies_or_moves;
+    }
+    buffer(buffer &&o) noexcept
+        : length(o.length)
+    {
+      ++copies_or_moves;
+    }
+  };
+  int buffer::copies_or_moves;
+  struct immovable
+  {
+    int v;
+    explicit immovable(int _v)
+        : v(_v)
+    {
+    }
+    immovable(immovable &&) = delete;
+  };
+  // Constructible from what the constructors unpacking success_ref() and failure_ref() take
+  struct from_tuple
+  {
+    int v;
+    from_tuple(std::tuple<int &&> t, std::index_sequence<0> /*unused*/)
+        : v(std::get<0>(t))
+    {
+    }
+  };
+}  // namespace success_failure_test
+
 BOOST_OUTCOME_AUTO_TEST_CASE(works / success - failure, "Tests that the success and failure type sugars work as intended")
 {
   using namespace OUTCOME_V2_NAMESPACE;
@@ -59,4 +130,95 @@ BOOST_OUTCOME_AUTO_TEST_CASE(works / success - failure, "Tests that the success
     static_assert(std::is_same<decltype(c)::exception_type, int>::value, "");
   }
 #endif
+  {
+    using namespace success_failure_test;
+    using ft = failure_type<counted<0>, counted<1>>;
+    static_assert(sizeof(failure_type<int, int>) <= 3 * sizeof(int), "failure_type<int, int> is not compact");
+    {
+      ft a(in_place_type<counted<0>>, 5);
+      BOOST_CHECK(a.has_error());
+      BOOST_CHECK(!a.has_exception());
+      BOOST_CHECK(constructed == 1);
+      ft b(a), c(std::move(a));
+      BOOST_CHECK(constructed == 3);
+      b = ft();
+      BOOST_CHECK(!b.has_error());
+      BOOST_CHECK(destroyed == 1);
+      b = c;
+      BOOST_CHECK(b.has_error() && b.error().v == 5);
+      BOOST_CHECK(constructed == 4);
+    }
+    BOOST_CHECK(constructed == destroyed);
+    constructed = destroyed = 0;
+    {
+      auto a = failure(counted<0>(1), counted<1>(2));
+      BOOST_CHECK(a.has_error() && a.has_exception());
+      BOOST_CHECK(a.error().v == 1 && a.exception().v == 2);
+    }
+    BOOST_CHECK(constructed == destroyed);
+    constructed = destroyed = 0;
+    {
+      // Moving out an absent member gives a default constructed one, and constructs nothing in the failure_type
+      ft a(in_place_type<counted<0>>, 5);
+      BOOST_CHECK(std::move(a).exception().v == 0);
+      BOOST_CHECK(!a.has_exception());
+      const ft b(a);
+      BOOST_CHECK(std::move(b).exception().v == 0);
+      BOOST_CHECK(std::move(b).error().v == 5);
+      BOOST_CHECK(std::move(a).error().v == 5);
+      auto e = failure_type<std::error_code, std::exception_ptr>(in_place_type<std::error_code>, std::make_error_code(std::errc::invalid_argument));
+      BOOST_CHECK(!std::move(e).exception());
+      BOOST_CHECK(!e.has_exception());
+    }
+    BOOST_CHECK(constructed == destroyed);
+    static_assert(noexcept(std::declval<ft>().has_error()) && noexcept(std::declval<ft>().has_exception()), "");
+
+    // Converting an errored outcome to and from its failure constructs no exception_ptr from nothing
+    outcome<int> o(std::make_error_code(std::errc::invalid_argument));
+    auto f = std::move(o).as_failure();
+    BOOST_CHECK(f.has_error());
+    BOOST_CHECK(!f.has_exception());
+    outcome<int> p(std::move(f));
+    BOOST_CHECK(p.has_error());
+    BOOST_CHECK(!p.has_exception());
+    BOOST_CHECK(p == failure_type<std::error_code, std::exception_ptr>(in_place_type<std::error_code>, std::make_error_code(std::errc::invalid_argument)));
+    BOOST_CHECK(!(p != failure_type<std::error_code, std::exception_ptr>(in_place_type<std::error_code>, std::make_error_code(std::errc::invalid_argument))));
+  }
+  // Construction through reference holding sugar has no intermediate copies
+  {
+    using namespace success_failure_test;
+    buffer::copies_or_moves = 0;
+    result<buffer> a = success(buffer(5));
+    BOOST_CHECK(a.value().length == 5);
+    BOOST_CHECK(buffer::copies_or_moves == 2);
+    buffer::copies_or_moves = 0;
+    result<buffer> b = success_ref(size_t(6));
+    BOOST_CHECK(b.value().length == 6);
+    BOOST_CHECK(buffer::copies_or_moves == 0);
+    buffer c(7);
+    result<buffer> d = success_ref(c);
+    BOOST_CHECK(d.value().length == 7);
+    BOOST_CHECK(buffer::copies_or_moves == 1);
+#if __cplusplus >= 201700L || _HAS_CXX17
+    result<immovable> e = success_ref(8);
+    BOOST_CHECK(e.value().v == 8);
+#endif
+    result<void> f = success_ref();
+    BOOST_CHECK(f);
+
+    result<int> g = failure_ref(EINVAL, std::generic_category());
+    BOOST_CHECK(g.error() == std::errc::invalid_argument);
+    outcome<buffer> h = success_ref(size_t(9));
+    BOOST_CHECK(h.value().length == 9);
+    BOOST_CHECK(buffer::copies_or_moves == 1);
+    outcome<buffer> i = failure_ref(EINVAL, std::generic_category());
+    BOOST_CHECK(i.error() == std::errc::invalid_argument);
+    BOOST_CHECK(!i.has_exception());
+
+    // In place construction from a tuple and index sequence constructs from those, not their contents
+    result<from_tuple> j(in_place_type<from_tuple>, std::forward_as_tuple(10), std::index_sequence<0>());
+    BOOST_CHECK(j.value().v == 10);
+    outcome<from_tuple> k(in_place_type<from_tuple>, std::forward_as_tuple(11), std::index_sequence<0>());
+    BOOST_CHECK(k.value().v == 11);
+  }
 }
@@ -0,0 +1,105 @@
+/* Unit testing for outcomes
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+    (See accompanying file Licence.txt or copy at
+          http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "../../include/outcome/outcome.hpp"
+#include "../../include/outcome/try_transform_view.hpp"
+
+#ifdef OUTCOME_FOUND_RANGES_HEADER
+
+#include "quickcpplib/boost/test/unit_test.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+BOOST_OUTCOME_AUTO_TEST_CASE(works / try_transform_view, "Tests that views::try_transform works as intended")
+{
+  using namespace OUTCOME_V2_NAMESPACE;
+  auto parse = [](const std::string &s) -> result<int> {
+    if(s.empty() || s.find_first_not_of("0123456789") != s.npos)
+    {
+      return make_error_code(std::errc::invalid_argument);
+    }
+    return std::stoi(s);
+  };
+  static_assert(std::ranges::input_range<try_transform_view<std::ranges::ref_view<std::vector<std::string>>, decltype(parse)>>);
+  static_assert(std::ranges::view<try_transform_view<std::ranges::ref_view<std::vector<std::string>>, decltype(parse)>>);
+
+  // All successful
+  {
+    std::vector<std::string> in{"1", "22", "333"};
+    auto v = in | views::try_transform(parse);
+    std::vector<int> out;
+    for(int i : v)
+    {
+      out.push_back(i);
+    }
+    BOOST_CHECK((out == std::vector<int>{1, 22, 333}));
+    BOOST_CHECK(!v.failed());
+    BOOST_CHECK(v.status());
+  }
+  // Stops at the first failure, lazily
+  {
+    std::vector<std::string> in{"1", "22", "x", "4", "y"};
+    int calls = 0;
+    auto v = views::try_transform(in, [&](const std::string &s) {
+      ++calls;
+      return parse(s);
+    });
+    BOOST_CHECK(calls == 0);
+    std::vector<int> out;
+    for(int i : v)
+    {
+      out.push_back(i);
+    }
+    BOOST_CHECK((out == std::vector<int>{1, 22}));
+    BOOST_CHECK(calls == 3);
+    BOOST_CHECK(v.failed());
+    BOOST_CHECK(v.status().error() == std::errc::invalid_argument);
+  }
+  // Over an input range, chained into another stage, with outcome
+  {
+    std::istringstream ss("5 6 7 8");
+    auto v = std::views::istream<std::string>(ss) | views::try_transform(parse) | std::views::transform([](int i) -> outcome<int> {
+               if(i == 7)
+               {
+                 return make_error_code(std::errc::result_out_of_range);
+               }
+               return i * 2;
+             }) |
+             views::try_transform(std::identity());
+    std::vector<int> out;
+    for(int i : v)
+    {
+      out.push_back(i);
+    }
+    BOOST_CHECK((out == std::vector<int>{10, 12}));
+    BOOST_CHECK(v.status().error() == std::errc::result_out_of_range);
+  }
+}
+#else
+int main(void)
+{
+  return 0;
+}
+#endif
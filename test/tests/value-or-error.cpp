@@ -24,6 +24,42 @@ Distributed under the Boost Software License, Version 1.0.
 #include "../../include/outcome/outcome.hpp"
 #include "quickcpplib/boost/test/unit_test.hpp"
 
+#include <vector>
+
+namespace value_or_error_test
+{
+  // A legacy type, as in the foreign_try snippet
+  enum Errc
+  {
+    kBadValue
+  };
+  template <class T> struct ForeignExpected
+  {
+    T Value;
+    Errc Error;
+    int IsErrored;
+  };
+}  // namespace value_or_error_test
+
+OUTCOME_V2_NAMESPACE_BEGIN
+namespace convert
+{
+  template <class T> struct value_or_error<result<T>, value_or_error_test::ForeignExpected<T>>
+  {
+    static constexpr bool enable_result_inputs = false;
+    static constexpr bool enable_outcome_inputs = false;
+    result<T> operator()(const value_or_error_test::ForeignExpected<T> &v) const
+    {
+      if(v.IsErrored != 0)
+      {
+        return make_error_code(std::errc::argument_out_of_domain);
+      }
+      return v.Value;
+    }
+  };
+}  // namespace convert
+OUTCOME_V2_NAMESPACE_END
+
 BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / valueorerror, "Tests that outcome constructs from ValueOrError and ValueOrNone concept inputs")
 {
   using namespace OUTCOME_V2_NAMESPACE;
@@ -44,4 +80,29 @@ BOOST_OUTCOME_AUTO_TEST_CASE(works / outcome / valueorerror, "Tests that outcome
     BOOST_CHECK(b.has_value());
     BOOST_CHECK(b.value() == 78);
   }
+  // Bulk conversion
+  {
+    using value_or_error_test::ForeignExpected;
+    ForeignExpected<int> in[4] = {{1, value_or_error_test::kBadValue, 0}, {0, value_or_error_test::kBadValue, 1}, {3, value_or_error_test::kBadValue, 0}, {4, value_or_error_test::kBadValue, 0}};
+    alignas(result<int>) char storage[sizeof(result<int>) * 4];
+    auto *out = reinterpret_cast<result<int> *>(storage);
+    BOOST_CHECK(convert::value_or_error_n(in, 4, out) == out + 4);
+    BOOST_CHECK(out[0].value() == 1);
+    BOOST_CHECK(out[1].error() == std::errc::argument_out_of_domain);
+    BOOST_CHECK(out[3].value() == 4);
+
+    static_assert(convert::is_layout_compatible<result<int>, result<int>>::value, "");
+    static_assert(!convert::is_layout_compatible<result<int>, ForeignExpected<int>>::value, "");
+    alignas(result<int>) char storage2[sizeof(result<int>) * 4];
+    auto *out2 = reinterpret_cast<result<int> *>(storage2);
+    convert::value_or_error_n(out, 4, out2);
+    BOOST_CHECK(out2[2].value() == 3);
+    BOOST_CHECK(out2[1].error() == std::errc::argument_out_of_domain);
+
+    std::vector<result<int>> v;
+    convert::value_or_error_into(in, v);
+    BOOST_CHECK(v.size() == 4);
+    BOOST_CHECK(v[2].value() == 3);
+    BOOST_CHECK(v[1].has_error());
+  }
 }